@@ -0,0 +1,757 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <functional>
+#include <limits>
+
+#include <unistd.h>
+
+#include "game.hpp"
+#include "simulator.hpp"
+
+/*
+    Benchmarks da persistência, seleção de palavras, pesquisa de jogadores, ordenação da
+    tabela de pontuações e composição de imagens. Os resultados são escritos em JSON no
+    stdout; o progresso é escrito no stderr.
+
+    Utilização: bench [--max-players <n>] [--max-words <n>] [--min-time <s>]
+
+    Os ficheiros de dados são gerados num diretório temporário, para não alterar os do jogo.
+*/
+
+struct bench_result {
+    std::string name;
+    long size;
+    long iterations;
+    double ns_per_op;
+    double best_ns_per_op;
+};
+
+static std::vector<bench_result> results;
+static double min_time = 0.2;
+
+/*
+    Executar "function" em lotes cada vez maiores até cada lote demorar pelo menos 1 ms,
+    repetindo depois os lotes até perfazer "min_time" segundos.
+*/
+void measure(std::string name, long size, std::function<void()> function) {
+    typedef std::chrono::steady_clock clock;
+
+    auto runBatch = [&](long batch) {
+        clock::time_point start = clock::now();
+        for (long i = 0; i < batch; i++) {
+            function();
+        }
+        return std::chrono::duration<double>(clock::now() - start).count();
+    };
+
+    long batch = 1;
+    double elapsed = runBatch(batch);
+    while ((elapsed < 1e-3) && (batch < (1L << 24))) {
+        batch *= 2;
+        elapsed = runBatch(batch);
+    }
+
+    long iterations = batch;
+    double total = elapsed;
+    double best = elapsed / batch;
+    while (total < min_time) {
+        elapsed = runBatch(batch);
+        iterations += batch;
+        total += elapsed;
+        best = std::min(best, elapsed / batch);
+    }
+
+    results.push_back({name, size, iterations, total * 1e9 / iterations, best * 1e9});
+    std::cerr << name << " [" << size << "]: " << total * 1e9 / iterations << " ns/op\n";
+}
+
+void writeResults(std::ostream& output) {
+    output << "{\n  \"results\": [\n";
+    for (size_t i = 0; i < results.size(); i++) {
+        bench_result& result = results[i];
+        output << "    {\"name\": \"" << result.name << "\", \"size\": " << result.size
+            << ", \"iterations\": " << result.iterations
+            << ", \"ns_per_op\": " << std::fixed << result.ns_per_op
+            << ", \"best_ns_per_op\": " << result.best_ns_per_op << "}"
+            << (i + 1 < results.size() ? ",\n" : "\n");
+    }
+    output << "  ]\n}\n";
+}
+
+/*
+    Opções de um jogo dos benchmarks: sem output e com o input "input" (normalmente vazio).
+*/
+game_options benchOptions(script_input& input) {
+    game_options options;
+    options.input = &input;
+    options.null_output = true;
+    return options;
+}
+
+void writePlayers(long count, std::mt19937& generator) {
+    std::stringstream data;
+    data << count << "\n";
+    for (long i = 0; i < count; i++) {
+        player generated("player" + std::to_string(i));
+        generated.score_persistent = generator() % 100000;
+        generated.rounds_persistent = generator() % 1000;
+        generated.fails_persistent = generator() % 5000;
+        generated.time_persistent = generator() % 100000;
+        generated.theme_persistent = internString("bench");
+        generated.toRawPlayerData(data);
+    }
+    replaceFileData("players.txt", data.str());
+}
+
+void writeThemes(long count, std::mt19937& generator) {
+    std::stringstream data;
+    data << 1 << "\n" << count + 1 << "\n" << "bench 0\n";
+    for (long i = 0; i < count; i++) {
+        data << "word" << i << " " << 1 + generator() % 20 << "\n";
+    }
+    replaceFileData("themes.txt", data.str());
+}
+
+/*
+    Tema "bench" com palavras de letras aleatórias (4 a 12 letras, com as frequências
+    aproximadas das letras em português), para o solver ter palavras realistas para separar.
+*/
+void writeDictionary(long count, std::mt19937& generator) {
+    static const char letters[] = "aaaaaaaaaaaaaaeeeeeeeeeeeeooooooooooossssssrrrrrriiiiiinnnnnddddddmmmmmuuuuutttttcccclllppvvggqbfhzjx";
+    std::uniform_int_distribution<int> length(4, 12);
+    std::uniform_int_distribution<int> letter(0, sizeof(letters) - 2);
+
+    std::stringstream data;
+    data << 1 << "\n" << count + 1 << "\n" << "bench 0\n";
+    for (long i = 0; i < count; i++) {
+        std::string word(length(generator), ' ');
+        for (char& character : word) {
+            character = letters[letter(generator)];
+        }
+        data << word << " " << 1 + generator() % 20 << "\n";
+    }
+    replaceFileData("themes.txt", data.str());
+}
+
+/*
+    Jogar uma ronda com as sugestões do solver, até descobrir a palavra ou perder.
+*/
+bool playRound(const solver& hints, const std::string& word) {
+    roundstate round;
+    round.start(word);
+
+    while ((round.getFails() < 9) && !round.isSolved()) {
+        char letter = hints.suggest(round.getPattern(), round.getCorrectLetters(), round.getMissingLetters());
+        if (letter == '\0') {
+            break;
+        }
+        round.guess(letter);
+    }
+    return round.isSolved();
+}
+
+/*
+    Leitura anterior de "players.txt" e "themes.txt" através de um stringstream, mantida apenas
+    como referência para comparar com o leitor atual.
+*/
+void streamLoadPlayers(std::list<player>& players) {
+    std::stringstream data;
+    data << std::ifstream("players.txt").rdbuf();
+    int playerCount = 0;
+
+    data >> playerCount;
+    for (int i = 0; i < playerCount; i++) {
+        player loaded;
+        loaded.fromRawPlayerData(data);
+        players.push_back(loaded);
+    }
+}
+
+void streamLoadThemes(std::list<std::list<word_info>>& themes) {
+    std::stringstream data;
+    data << std::ifstream("themes.txt").rdbuf();
+    int themeCount = 0;
+
+    data >> themeCount;
+    for (int i = 0; i < themeCount; i++) {
+        std::list<word_info> loadedTheme;
+        int wordCount = 0;
+
+        data >> wordCount;
+        for (int j = 0; j < wordCount; j++) {
+            word_info loadedWord;
+            std::string word;
+            data >> word >> loadedWord.occurences;
+            loadedWord.word = internString(word);
+            loadedTheme.push_back(loadedWord);
+        }
+        themes.push_back(loadedTheme);
+    }
+}
+
+/*
+    Escolha anterior de "selectRandomWord", percorrendo as palavras do tema, mantida como
+    referência para o sorteio na árvore de Fenwick. Devolve "words.size()" se nenhuma palavra
+    for escolhida.
+*/
+long long linearTotalWeight(const std::vector<word_info>& words) {
+    long long total = 0;
+    for (const word_info& word : words) {
+        total += getWordWeight(word.occurences);
+    }
+    return total;
+}
+
+size_t linearSelectWord(const std::vector<word_info>& words, long long threshold) {
+    for (size_t i = 0; i < words.size(); i++) {
+        int weight = getWordWeight(words[i].occurences);
+        if (threshold < weight) {
+            return i;
+        }
+        threshold -= weight;
+    }
+    return words.size();
+}
+
+class benchmark {
+public:
+    /*
+        Verificar que o sorteio na árvore de Fenwick escolhe sempre a mesma palavra que a
+        pesquisa linear, e que as frequências observadas seguem os pesos (teste do qui-quadrado).
+    */
+    static bool sampler(std::mt19937& generator) {
+        theme_info theme = {internString("sampler"), {}, {}};
+        for (int i = 0; i < 1000; i++) {
+            int occurences = (generator() % 5 == 0) ? 0 : 1 + generator() % 40;
+            if (generator() % 100 == 0) {
+                occurences = 10001;
+            }
+            theme.words.push_back({internString("sampler" + std::to_string(i)), occurences});
+        }
+        themecatalog::updateSampler(theme);
+
+        for (int draw = 0; draw < 200000; draw++) {
+            if (theme.sampler.total() != linearTotalWeight(theme.words)) {
+                std::cerr << "sampler: total diferente na escolha " << draw << "\n";
+                return false;
+            }
+
+            long long threshold = generator() % (theme.sampler.total() + 1);
+            size_t index = theme.sampler.find(threshold);
+            if (index != linearSelectWord(theme.words, threshold)) {
+                std::cerr << "sampler: escolha diferente para " << threshold << "\n";
+                return false;
+            }
+
+            if (index < theme.words.size()) {
+                int weight = getWordWeight(theme.words[index].occurences);
+                theme.words[index].occurences++;
+                theme.sampler.update(index, getWordWeight(theme.words[index].occurences) - weight);
+            } else {
+                for (word_info& word : theme.words) {
+                    word.occurences = (word.occurences == 0) ? 0 : 1;
+                }
+                themecatalog::updateSampler(theme);
+            }
+        }
+
+        // Limites de cada palavra: o último valor que a escolhe e o primeiro que escolhe a seguinte.
+        long long prefix = 0;
+        for (size_t i = 0; i < theme.words.size(); i++) {
+            prefix += getWordWeight(theme.words[i].occurences);
+            for (long long threshold : {prefix - 1, prefix}) {
+                if ((threshold >= 0) && (theme.sampler.find(threshold) != linearSelectWord(theme.words, threshold))) {
+                    std::cerr << "sampler: escolha diferente para " << threshold << "\n";
+                    return false;
+                }
+            }
+        }
+
+        theme.words.clear();
+        for (int i = 0; i < 16; i++) {
+            theme.words.push_back({internString("sampler" + std::to_string(i)), 1 + i});
+        }
+        themecatalog::updateSampler(theme);
+
+        const long draws = 160000;
+        std::vector<long> observed(theme.words.size(), 0);
+        std::uniform_int_distribution<long long> uniform(0, theme.sampler.total() - 1);
+        for (long i = 0; i < draws; i++) {
+            observed[theme.sampler.find(uniform(generator))]++;
+        }
+
+        double chi_square = 0;
+        for (size_t i = 0; i < theme.words.size(); i++) {
+            double expected = (double)draws * getWordWeight(theme.words[i].occurences) / theme.sampler.total();
+            chi_square += (observed[i] - expected) * (observed[i] - expected) / expected;
+        }
+
+        // Valor crítico para 15 graus de liberdade com p = 0.001.
+        std::cerr << "sampler: qui-quadrado " << chi_square << " (limite 37.7)\n";
+        return chi_square < 37.7;
+    }
+
+    /*
+        Verificar que "randi" nunca sai do intervalo, que os valores são uniformes (teste do
+        qui-quadrado) e que a mesma semente repete a sequência.
+    */
+    static bool random() {
+        xoshiro256 first(1234);
+        xoshiro256 second(1234);
+        xoshiro256 other(1234, 1);
+        xoshiro256 swapped(1, 1234);
+        xoshiro256 same(1234, 1234);
+        bool different = false;
+        bool asymmetric = false;
+        bool mixed = false;
+        for (int i = 0; i < 1000; i++) {
+            uint64_t value = first();
+            if (value != second()) {
+                std::cerr << "random: sequencias diferentes com a mesma semente\n";
+                return false;
+            }
+            uint64_t stream = other();
+            different |= (value != stream);
+            asymmetric |= (stream != swapped());
+            mixed |= (value != same());
+        }
+        if (!different || !asymmetric || !mixed) {
+            std::cerr << "random: sequencias iguais com sementes ou streams diferentes\n";
+            return false;
+        }
+
+        const long draws = 200000;
+        std::vector<long> observed(10, 0);
+        for (long i = 0; i < draws; i++) {
+            int value = randi(first, 0, 9);
+            if ((value < 0) || (value > 9)) {
+                std::cerr << "random: valor " << value << " fora do intervalo [0, 9]\n";
+                return false;
+            }
+            observed[value]++;
+        }
+
+        double chi_square = 0;
+        double expected = (double)draws / observed.size();
+        for (long count : observed) {
+            chi_square += (count - expected) * (count - expected) / expected;
+        }
+
+        int chosen = 0;
+        measure("randi", 1, [&]() {
+            chosen += randi(first, 0, 9);
+        });
+        measure("randi (rand)", 1, [&]() {
+            chosen += map(rand(), 0.0, RAND_MAX, 0, 9);
+        });
+
+        // Valor crítico para 9 graus de liberdade com p = 0.001.
+        std::cerr << "random: qui-quadrado " << chi_square << " (limite 27.9)\n";
+        return chi_square < 27.9;
+    }
+
+    static void players(long count, std::mt19937& generator) {
+        writePlayers(count, generator);
+        writeThemes(10, generator);
+
+        script_input input({});
+        game bench_game(benchOptions(input));
+
+        measure("loadPlayerData", count, [&]() {
+            bench_game.players.clear();
+            bench_game.loadPlayerData();
+        });
+
+        measure("loadPlayerData (stringstream)", count, [&]() {
+            std::list<player> loaded;
+            streamLoadPlayers(loaded);
+        });
+
+        // As gravações são feitas pelo escritor em segundo plano: os casos com o nome original
+        // esperam que cheguem ao disco (comparáveis com a gravação síncrona), os casos
+        // "(enqueue)" medem apenas o pedido, que pode ser junto com o anterior.
+        measure("savePlayerData", count, [&]() {
+            bench_game.savePlayerData();
+            bench_game.persistence.flush();
+        });
+
+        measure("savePlayerData (enqueue)", count, [&]() {
+            bench_game.savePlayerData();
+        });
+        bench_game.persistence.flush();
+
+        player first;
+        bench_game.players.get(0, first);
+
+        measure("updatePlayerData", count, [&]() {
+            bench_game.updatePlayerData(first);
+            bench_game.persistence.flush();
+        });
+
+        measure("updatePlayerData (enqueue)", count, [&]() {
+            bench_game.updatePlayerData(first);
+        });
+        bench_game.persistence.flush();
+
+        measure("player::toRawPlayerData", count, [&]() {
+            std::stringstream data;
+            player temp;
+            for (player_handle handle = 0; handle < bench_game.players.size(); handle++) {
+                bench_game.players.get(handle, temp);
+                temp.toRawPlayerData(data);
+            }
+        });
+
+        long total = 0;
+        measure("playertable score scan", count, [&]() {
+            for (player_handle handle = 0; handle < bench_game.players.size(); handle++) {
+                total += bench_game.players.getScore(handle);
+            }
+        });
+
+        std::stringstream raw;
+        player temp;
+        for (player_handle handle = 0; handle < bench_game.players.size(); handle++) {
+            bench_game.players.get(handle, temp);
+            temp.toRawPlayerData(raw);
+        }
+        std::string raw_data = raw.str();
+
+        measure("player::fromRawPlayerData", count, [&]() {
+            std::stringstream data(raw_data);
+            player loaded;
+            for (long i = 0; i < count; i++) {
+                loaded.fromRawPlayerData(data);
+            }
+        });
+
+        measure("player::parseRawPlayerData", count, [&]() {
+            textparser data(raw_data, "bench");
+            player loaded;
+            for (long i = 0; i < count; i++) {
+                loaded.parseRawPlayerData(data);
+            }
+        });
+
+        playerstore store;
+        store.open("players.bin", true);
+        for (player_handle handle = 0; handle < bench_game.players.size(); handle++) {
+            bench_game.players.get(handle, temp);
+            store.write(temp);
+        }
+
+        bench_game.players.get(0, first);
+        first.store_index = 0;
+        measure("playerstore::write", count, [&]() {
+            store.write(first);
+        });
+
+        measure("playerstore::load", count, [&]() {
+            playertable loaded;
+            store.load(loaded);
+        });
+
+        measure("getPlayerFromUsername", count, [&]() {
+            bench_game.getPlayerFromUsername("player" + std::to_string(generator() % count));
+        });
+
+        measure("leaderboard build", count, [&]() {
+            bench_game.leaderboard_ready = false;
+            bench_game.getLeaderboard();
+        });
+
+        measure("leaderboard page", count, [&]() {
+            bench_game.getLeaderboard().page(count / 2, 7);
+        });
+
+        measure("leaderboard rank", count, [&]() {
+            bench_game.getLeaderboard().rank("player" + std::to_string(generator() % count));
+        });
+
+        measure("leaderboard update", count, [&]() {
+            player_handle updated = bench_game.getPlayerFromUsername("player" + std::to_string(generator() % count));
+            bench_game.getLeaderboard().update(bench_game.players.getUsername(updated), generator() % 100000);
+        });
+
+    }
+
+    static void lazyPlayers(long count, std::mt19937& generator) {
+        writePlayers(count, generator);
+        writeThemes(10, generator);
+        unlink("players.idx");
+
+        script_input input({});
+        game_options options = benchOptions(input);
+        options.lazy_loading = true;
+        game bench_game(options);
+
+        measure("loadPlayerData (lazy)", count, [&]() {
+            bench_game.players.clear();
+            bench_game.loadPlayerData();
+        });
+
+        measure("getPlayerFromUsername (lazy)", count, [&]() {
+            bench_game.players.clear();
+            player_handle loaded = bench_game.getPlayerFromUsername("player" + std::to_string(generator() % count));
+            bench_game.index.find(bench_game.players.getUsername(loaded))->loaded = false;
+        });
+
+        bench_game.getLeaderboard();
+        measure("leaderboard page (lazy)", count, [&]() {
+            bench_game.getLeaderboard().page(count / 2, 7);
+        });
+    }
+
+    static void words(long count, std::mt19937& generator) {
+        writePlayers(10, generator);
+        writeThemes(count, generator);
+
+        script_input input({});
+        game bench_game(benchOptions(input));
+
+        measure("loadThemeData", count, [&]() {
+            bench_game.themes.clear();
+            bench_game.loadThemeData();
+        });
+
+        measure("loadThemeData (stringstream)", count, [&]() {
+            std::list<std::list<word_info>> loaded;
+            streamLoadThemes(loaded);
+        });
+
+        measure("selectRandomWord", count, [&]() {
+            bench_game.selectRandomWord(internString("bench"));
+        });
+
+        std::vector<word_info>& words = bench_game.getThemeFromName(internString("bench")).words;
+        size_t chosen = 0;
+        measure("selectRandomWord (linear)", count, [&]() {
+            chosen += linearSelectWord(words, generator() % (linearTotalWeight(words) + 1));
+        });
+    }
+
+    static void rounds() {
+        roundstate round;
+        std::string word = "programacao";
+        word_metadata metadata = describeWord(word);
+        int solved = 0;
+        measure("roundstate round", 1, [&]() {
+            round.start(word, metadata);
+            for (char letter = 'z'; (letter >= 'a') && (round.getFails() < 9) && !round.isSolved(); letter--) {
+                round.guess(letter);
+            }
+            solved += round.isSolved();
+        });
+    }
+
+    // Jogar todas as palavras de todos os temas embutidos no executável.
+    static void solverThemes(std::mt19937& generator) {
+        writePlayers(10, generator);
+        unlink("themes.txt");
+
+        script_input input({});
+        game bench_game(benchOptions(input));
+
+        long words = 0;
+        for (theme_info& theme : bench_game.themes) {
+            words += theme.words.size();
+        }
+
+        std::vector<solver> solvers(bench_game.themes.size());
+        measure("solver build (themes)", words, [&]() {
+            for (size_t i = 0; i < solvers.size(); i++) {
+                solvers[i].build(bench_game.themes[i]);
+            }
+        });
+
+        long played = 0;
+        long solved = 0;
+        measure("solver play (themes)", words, [&]() {
+            played = 0;
+            solved = 0;
+            for (size_t i = 0; i < solvers.size(); i++) {
+                for (word_info& word : bench_game.themes[i].words) {
+                    solved += playRound(solvers[i], getString(word.word));
+                    played++;
+                }
+            }
+        });
+        std::cerr << "solver: " << solved << " de " << played << " palavras descobertas\n";
+    }
+
+    /*
+        Simular rondas com os temas embutidos numa só thread e numa thread por núcleo. Os
+        resultados têm de ser iguais, porque não dependem do número de threads.
+    */
+    static bool simulation() {
+        unlink("themes.txt");
+        themecatalog catalog;
+        std::string error;
+        if (!loadThemeCatalog(catalog, error)) {
+            std::cerr << "simulation: " << error << "\n";
+            return false;
+        }
+
+        sim_options options;
+        options.rounds = 16384;
+        options.sessions = 16;
+        options.seed = 1234;
+
+        workpool single(1);
+        // Pelo menos 4 threads, para que a comparação reparta os lotes mesmo com poucos núcleos.
+        workpool all(std::max(4u, std::thread::hardware_concurrency()));
+        simulator simulation;
+        simulation.build(catalog, all);
+
+        std::vector<sim_theme_stats> single_stats;
+        std::vector<sim_theme_stats> all_stats;
+        measure("simulator (1 thread)", options.rounds, [&]() {
+            simulation.run(options, single, single_stats);
+        });
+        measure("simulator (" + std::to_string(all.size()) + " threads)", options.rounds, [&]() {
+            simulation.run(options, all, all_stats);
+        });
+
+        for (size_t i = 0; i < single_stats.size(); i++) {
+            for (size_t difficulty = 0; difficulty < single_stats[i].difficulties.size(); difficulty++) {
+                const sim_totals& a = single_stats[i].difficulties[difficulty];
+                const sim_totals& b = all_stats[i].difficulties[difficulty];
+                if ((a.rounds != b.rounds) || (a.wins != b.wins) || (a.score != b.score)
+                    || (a.fails != b.fails) || (a.guesses != b.guesses) || (a.time != b.time)) {
+                    std::cerr << "simulation: resultados diferentes no tema " << simulation.getThemeName(i) << "\n";
+                    return false;
+                }
+            }
+            if ((single_stats[i].draws != all_stats[i].draws) || (single_stats[i].resets != all_stats[i].resets)) {
+                std::cerr << "simulation: sorteios diferentes no tema " << simulation.getThemeName(i) << "\n";
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static void solverWords(long count, std::mt19937& generator) {
+        writePlayers(10, generator);
+        writeDictionary(count, generator);
+
+        script_input input({});
+        game bench_game(benchOptions(input));
+
+        theme_info& theme = bench_game.getThemeFromName(internString("bench"));
+        solver hints;
+        measure("solver build", count, [&]() {
+            hints.build(theme);
+        });
+
+        long played = 0;
+        long solved = 0;
+        measure("solver play", count, [&]() {
+            solved += playRound(hints, getString(theme.words[generator() % theme.words.size()].word));
+            played++;
+        });
+        std::cerr << "solver: " << solved << " de " << played << " palavras descobertas\n";
+    }
+
+    static void render(std::mt19937& generator) {
+        writePlayers(10, generator);
+        writeThemes(10, generator);
+
+        script_input input({});
+        game bench_game(benchOptions(input));
+
+        int frame = 0;
+        measure("render frame", 1, [&]() {
+            bench_game.render(bench_game.getImageAtIndex(6 + (frame++ % 2)));
+            for (int i = 0; i < 7; i++) {
+                bench_game.stamp(44, 5 + i * 3, "player" + std::to_string(i));
+                bench_game.stamp(44, 6 + i * 3, std::to_string(i * 100) + " Pts.");
+            }
+            bench_game.commit(10, 31);
+        });
+    }
+};
+
+bool parseArgument(const char* value, double& result) {
+    char* end = nullptr;
+    result = strtod(value, &end);
+    return (end != value) && (*end == '\0') && (result > 0);
+}
+
+int main(int argc, char** argv) {
+    double max_players = 1000000;
+    double max_words = 100000;
+
+    for (int i = 1; i < argc; i++) {
+        std::string argument = argv[i];
+        bool valid = (i + 1 < argc);
+
+        if (valid && (argument == "--max-players")) {
+            valid = parseArgument(argv[++i], max_players);
+        } else if (valid && (argument == "--max-words")) {
+            valid = parseArgument(argv[++i], max_words);
+        } else if (valid && (argument == "--min-time")) {
+            valid = parseArgument(argv[++i], min_time);
+        } else {
+            valid = false;
+        }
+
+        if (!valid) {
+            std::cerr << "Utilizacao: " << argv[0] << " [--max-players <n>] [--max-words <n>] [--min-time <s>]\n";
+            return -1;
+        }
+    }
+
+    char directory[] = "/tmp/hangman-bench-XXXXXX";
+    if ((mkdtemp(directory) == nullptr) || (chdir(directory) != 0)) {
+        std::cerr << "Erro: Nao foi possivel criar o diretorio temporario\n";
+        return -1;
+    }
+
+    std::mt19937 generator(1234);
+
+    if (!benchmark::sampler(generator)) {
+        std::cerr << "Erro: O sorteio das palavras nao corresponde a pesquisa linear\n";
+        return -1;
+    }
+
+    if (!benchmark::random()) {
+        std::cerr << "Erro: O gerador aleatorio nao e uniforme\n";
+        return -1;
+    }
+
+    for (long count = 10; count <= max_players; count *= 10) {
+        benchmark::players(count, generator);
+        benchmark::lazyPlayers(count, generator);
+    }
+
+    for (long count = 10; count <= max_words; count *= 10) {
+        benchmark::words(count, generator);
+        benchmark::solverWords(count, generator);
+    }
+    benchmark::solverThemes(generator);
+
+    if (!benchmark::simulation()) {
+        std::cerr << "Erro: A simulacao depende do numero de threads\n";
+        return -1;
+    }
+
+    benchmark::rounds();
+    benchmark::render(generator);
+
+    unlink("players.txt");
+    unlink("themes.txt");
+    unlink("players.journal");
+    unlink("players.bin");
+    unlink("players.idx");
+    if ((chdir("/") != 0) || (rmdir(directory) != 0)) {
+        std::cerr << "Aviso: Nao foi possivel remover \'" << directory << "\'\n";
+    }
+
+    writeResults(std::cout);
+    return 0;
+}
@@ -0,0 +1,798 @@
+// Gerado pelo Makefile a partir de 'images.txt' e 'themes.txt'. Nao editar.
+#ifndef EMBEDDED_HPP
+#define EMBEDDED_HPP
+
+#include <string_view>
+
+inline constexpr int embedded_image_width = 73;
+inline constexpr int embedded_image_height = 32;
+inline constexpr int embedded_image_count = 23;
+
+inline constexpr char embedded_images[] =
+    "+----------------------------------------------------------------------+\n"
+    "|                                                                      |\n"
+    "| 1D''''''''''''''''''''''''1                                          |\n"
+    "| 1                        ,4D                                         |\n"
+    "| 1                      @'   \"%.                                      |\n"
+    "| 1                     #       @                                      |\n"
+    "| 1                     1      ]'                                      |\n"
+    "| 1                      Yww,dM                                        |\n"
+    "| #                         N                                          |\n"
+    "| @                        JD     ,                                    |\n"
+    "| @                        jM*\"\"''                                     |\n"
+    "| JN                        ]                                          |\n"
+    "| ]                         @                                          |\n"
+    "| #                         M                                          |\n"
+    "| @                       ,MN,                                         |\n"
+    "| @                    ,#\"    *W                                       |\n"
+    "| @                  aM         *W                                     |\n"
+    "| @                                                                    |\n"
+    "| @                                                                    |\n"
+    "| N                                                                    |\n"
+    "| '''''''''''''''''''\"\"\"\"*******\"'                                     |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "| &   &        e           W               ,  ,.      ,             ]  |\n"
+    "| @,,,@       @ $     ,@   @               M1@D@     JD@       &*W  &  |\n"
+    "| @   @      M   @    # \"WJN              #    $    ,K\"\"@      @  *WM  |\n"
+    "| *         '    '    '   \"               '    *    C   \"              |\n"
+    "| \"\"\"\"\"\"\"'   \"\"\"\"\"\"   *^^^^^    >^^***\"    ***^^^   ^^^^^^    m>^^^^^  |\n"
+    "|                                                                      |\n"
+    "+----------------------------------------------------------------------+\n"
+    "| Utilizador:                                                          |\n"
+    "+----------------------------------------------------------------------+\n"
+    "+----------------------------------------------------------------------+\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                Menu                                  |\n"
+    "|                 +---------------------------------+                  |\n"
+    "|                 |                                 |                  |\n"
+    "|                 |     1- Jogar                    |                  |\n"
+    "|                 |                                 |                  |\n"
+    "|                 |     2- Modo de Funcionamento    |                  |\n"
+    "|                 |                                 |                  |\n"
+    "|                 |     3- Pontuacoes               |                  |\n"
+    "|                 |                                 |                  |\n"
+    "|                 |     4- Configurar Temas         |                  |\n"
+    "|                 |---------------------------------|                  |\n"
+    "|                 |     5- Sair                     |                  |\n"
+    "|                 +---------------------------------+                  |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "+----------------------------------------------------------------------+\n"
+    "| Opcao:                                                               |\n"
+    "+----------------------------------------------------------------------+\n"
+    "+----------------------------------------------------------------------+\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                             Confirmacao                              |\n"
+    "|                 +---------------------------------+                  |\n"
+    "|                 |                                 |                  |\n"
+    "|                 | Tem a certeza que deseja sair\?  |                  |\n"
+    "|                 |                                 |                  |\n"
+    "|                 |                                 |                  |\n"
+    "|                 |                                 |                  |\n"
+    "|                 |                                 |                  |\n"
+    "|                 +---------------------------------+                  |\n"
+    "|                 |     1- Sim           2- Nao     |                  |\n"
+    "|                 +---------------------------------+                  |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "+----------------------------------------------------------------------+\n"
+    "| Opcao:                                                               |\n"
+    "+----------------------------------------------------------------------+\n"
+    "+----------------------------------------------------------------------+\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                        Modo de Funcionamento                         |\n"
+    "|                 +---------------------------------+                  |\n"
+    "|                 |                                 |                  |\n"
+    "|                 |     1- Elementar                |                  |\n"
+    "|                 |                                 |                  |\n"
+    "|                 |     2- Basico                   |                  |\n"
+    "|                 |                                 |                  |\n"
+    "|                 |     3- Medio                    |                  |\n"
+    "|                 |                                 |                  |\n"
+    "|                 |     4- Avancado                 |                  |\n"
+    "|                 |                                 |                  |\n"
+    "|                 |     5- Profissional             |                  |\n"
+    "|                 |---------------------------------|                  |\n"
+    "|                 |     6- Voltar ao Menu           |                  |\n"
+    "|                 +---------------------------------+                  |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "+----------------------------------------------------------------------+\n"
+    "| Opcao:                                                               |\n"
+    "+----------------------------------------------------------------------+\n"
+    "+----------------------------------------------------------------------+\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                             Dificuldade                              |\n"
+    "|                 +---------------------------------+                  |\n"
+    "|                 |                                 |                  |\n"
+    "|                 |     1- Facil                    |                  |\n"
+    "|                 |                                 |                  |\n"
+    "|                 |     2- Medio                    |                  |\n"
+    "|                 |                                 |                  |\n"
+    "|                 |     3- Dificil                  |                  |\n"
+    "|                 +---------------------------------+                  |\n"
+    "|                 |     4- Voltar ao Menu           |                  |\n"
+    "|                 +---------------------------------+                  |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "+----------------------------------------------------------------------+\n"
+    "| Opcao:                                                               |\n"
+    "+----------------------------------------------------------------------+\n"
+    "+----------------------------------------------------------------------+\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                Aviso                                 |\n"
+    "|                 +---------------------------------+                  |\n"
+    "|                 |                                 |                  |\n"
+    "|                 | Foi detetado um jogo ainda por  |                  |\n"
+    "|                 | terminar, deseja continuar com  |                  |\n"
+    "|                 | esse jogo ou iniciar um novo\?   |                  |\n"
+    "|                 |                                 |                  |\n"
+    "|                 |                                 |                  |\n"
+    "|                 +---------------------------------+                  |\n"
+    "|                 |  1- Continuar     2- Novo Jogo  |                  |\n"
+    "|                 +---------------------------------+                  |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "+----------------------------------------------------------------------+\n"
+    "| Opcao:                                                               |\n"
+    "+----------------------------------------------------------------------+\n"
+    "+----------------------------------------------------------------------+\n"
+    "|                                                                      |\n"
+    "|       Estatisticas do jogador             Melhores pontuacoes        |\n"
+    "|   +----------------------------+    +--+-------------------------+   |\n"
+    "|   |                            |    |  |                         |   |\n"
+    "|   |                            |    |  |                         |   |\n"
+    "|   |                            |    +--+-------------------------+   |\n"
+    "|   |   Pontos :                 |    |  |                         |   |\n"
+    "|   |                            |    |  |                         |   |\n"
+    "|   |   Jogos  :                 |    +--+-------------------------+   |\n"
+    "|   |                            |    |  |                         |   |\n"
+    "|   |   Falhas :                 |    |  |                         |   |\n"
+    "|   |                            |    +--+-------------------------+   |\n"
+    "|   |   Tempo  :                 |    |  |                         |   |\n"
+    "|   |                            |    |  |                         |   |\n"
+    "|   |                            |    +--+-------------------------+   |\n"
+    "|   |                            |    |  |                         |   |\n"
+    "|   |                            |    |  |                         |   |\n"
+    "|   |                            |    +--+-------------------------+   |\n"
+    "|   |                            |    |  |                         |   |\n"
+    "|   |                            |    |  |                         |   |\n"
+    "|   |                            |    +--+-------------------------+   |\n"
+    "|   |                            |    |  |                         |   |\n"
+    "|   |                            |    |  |                         |   |\n"
+    "|   +----------------------------+----+--+-------------------------+   |\n"
+    "|   |  1- Voltar ao Menu   2- Pagina anterior   3- Pagina seguinte |   |\n"
+    "|   +--------------------------------------------------------------+   |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "+----------------------------------------------------------------------+\n"
+    "| Opcao:                                                               |\n"
+    "+----------------------------------------------------------------------+\n"
+    "+----------------------------------------------------------------------+\n"
+    "|                                                                      |\n"
+    "|                                     +---+------------------------+   |\n"
+    "|                                     |   |                        |   |\n"
+    "|                                     |   |                        |   |\n"
+    "|                                     |---|------------------------|   |\n"
+    "|                                     |   |                        |   |\n"
+    "|                                     |   |                        |   |\n"
+    "|                                     |---|------------------------|   |\n"
+    "|                                     |   |                        |   |\n"
+    "|                                     |   |                        |   |\n"
+    "|                                     |---|------------------------|   |\n"
+    "|                                     |   |                        |   |\n"
+    "|                                     |   |                        |   |\n"
+    "|                                     |---|------------------------|   |\n"
+    "|                                     |   |                        |   |\n"
+    "|                                     |   |                        |   |\n"
+    "|                                     |---|------------------------|   |\n"
+    "|           Selecionar Tema           |   |                        |   |\n"
+    "|   +-----------------------------+   |   |                        |   |\n"
+    "|   |                             |   |---|------------------------|   |\n"
+    "|   | Introduzir o nome do tema   |   |   |                        |   |\n"
+    "|   | que deseja jogar.           |   |   |                        |   |\n"
+    "|   |                             |   |---|------------------------|   |\n"
+    "|   | Utilize as teclas 1 e 2     |   |   |                        |   |\n"
+    "|   | para subir ou descer a      |   |   |                        |   |\n"
+    "|   | lista de temas.             |   +---+------------------------+   |\n"
+    "|   |                             |   |   |  1- Subir   2- Descer  |   |\n"
+    "|   +-----------------------------+   +---+------------------------+   |\n"
+    "+----------------------------------------------------------------------+\n"
+    "| Opcao:                                                               |\n"
+    "+----------------------------------------------------------------------+\n"
+    "+--------------------+-------------------------------+-----------------+\n"
+    "| Tempo:             |                               |     Erradas:    |\n"
+    "+--------------------+                               |                 |\n"
+    "| Score:             |                               |                 |\n"
+    "+--------------------|                               |                 |\n"
+    "| Tema:              |                               |                 |\n"
+    "|--------------------+                               +-----------------+\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|              +--------------------------------------+                |\n"
+    "|              |                                      |                |\n"
+    "|              |                                      |   1- Suspender |\n"
+    "+--------------+--------------------------------------+----------------+\n"
+    "| Opcao:                                                               |\n"
+    "+----------------------------------------------------------------------+\n"
+    "+--------------------+-------------------------------+-----------------+\n"
+    "| Tempo:             |                               |     Erradas:    |\n"
+    "+--------------------+    Ja erraste uma malandro    |                 |\n"
+    "| Score:             |                               |                 |\n"
+    "+--------------------|                               |                 |\n"
+    "| Tema:              |                               |                 |\n"
+    "|--------------------+                               +-----------------+\n"
+    "|                                                                      |\n"
+    "|                        +                                             |\n"
+    "|                        |                                             |\n"
+    "|                        |                                             |\n"
+    "|                        |                                             |\n"
+    "|                        |                                             |\n"
+    "|                        |                                             |\n"
+    "|                        |                                             |\n"
+    "|                        |                                             |\n"
+    "|                        |                                             |\n"
+    "|                        |                                             |\n"
+    "|                        |                                             |\n"
+    "|                        |                                             |\n"
+    "|                        |                                             |\n"
+    "|                        |                                             |\n"
+    "|                        |                                             |\n"
+    "|                        |                                             |\n"
+    "|                        |                                             |\n"
+    "|                        *                                             |\n"
+    "|              +--------------------------------------+                |\n"
+    "|              |                                      |                |\n"
+    "|              |                                      |   1- Suspender |\n"
+    "+--------------+--------------------------------------+----------------+\n"
+    "| Opcao:                                                               |\n"
+    "+----------------------------------------------------------------------+\n"
+    "+--------------------+-------------------------------+-----------------+\n"
+    "| Tempo:             |                               |     Erradas:    |\n"
+    "+--------------------+        Ja vi tudoooo!!!       |                 |\n"
+    "| Score:             |                               |                 |\n"
+    "+--------------------|                               |                 |\n"
+    "| Tema:              |                               |                 |\n"
+    "|--------------------+                               +-----------------+\n"
+    "|                                                                      |\n"
+    "|                        +                                             |\n"
+    "|                        |                                             |\n"
+    "|                        |                                             |\n"
+    "|                        |                                             |\n"
+    "|                        |                                             |\n"
+    "|                        |                                             |\n"
+    "|                        |                                             |\n"
+    "|                        |                                             |\n"
+    "|                        |                                             |\n"
+    "|                        |                                             |\n"
+    "|                        |                                             |\n"
+    "|                        |                                             |\n"
+    "|                       *|*                                            |\n"
+    "|                      **|**                                           |\n"
+    "|                     ***|***                                          |\n"
+    "|                    ****|****                                         |\n"
+    "|                   *****|*****                                        |\n"
+    "|                  *************                                       |\n"
+    "|              +--------------------------------------+                |\n"
+    "|              |                                      |                |\n"
+    "|              |                                      |   1- Suspender |\n"
+    "+--------------+--------------------------------------+----------------+\n"
+    "| Opcao:                                                               |\n"
+    "+----------------------------------------------------------------------+\n"
+    "+--------------------+-------------------------------+-----------------+\n"
+    "| Tempo:             |                               |     Erradas:    |\n"
+    "+--------------------+      BAH!!Esta e Facil!!      |                 |\n"
+    "| Score:             |                               |                 |\n"
+    "+--------------------|                               |                 |\n"
+    "| Tema:              |                               |                 |\n"
+    "|--------------------+                               +-----------------+\n"
+    "|                                                                      |\n"
+    "|                        +----------------                             |\n"
+    "|                        |                                             |\n"
+    "|                        |                                             |\n"
+    "|                        |                                             |\n"
+    "|                        |                                             |\n"
+    "|                        |                                             |\n"
+    "|                        |                                             |\n"
+    "|                        |                                             |\n"
+    "|                        |                                             |\n"
+    "|                        |                                             |\n"
+    "|                        |                                             |\n"
+    "|                        |                                             |\n"
+    "|                       *|*                                            |\n"
+    "|                      **|**                                           |\n"
+    "|                     ***|***                                          |\n"
+    "|                    ****|****                                         |\n"
+    "|                   *****|*****                                        |\n"
+    "|                  *************                                       |\n"
+    "|              +--------------------------------------+                |\n"
+    "|              |                                      |                |\n"
+    "|              |                                      |   1- Suspender |\n"
+    "+--------------+--------------------------------------+----------------+\n"
+    "| Opcao:                                                               |\n"
+    "+----------------------------------------------------------------------+\n"
+    "+--------------------+-------------------------------+-----------------+\n"
+    "| Tempo:             |                               |     Erradas:    |\n"
+    "+--------------------+ Bem todos temos dias maus...  |                 |\n"
+    "| Score:             |                               |                 |\n"
+    "+--------------------|                               |                 |\n"
+    "| Tema:              |                               |                 |\n"
+    "|--------------------+                               +-----------------+\n"
+    "|                                                                      |\n"
+    "|                        +----------------                             |\n"
+    "|                        |               |                             |\n"
+    "|                        |               |                             |\n"
+    "|                        |               |                             |\n"
+    "|                        |            @@@@@@                           |\n"
+    "|                        |           @      @                          |\n"
+    "|                        |           @      @                          |\n"
+    "|                        |            @@@@@@                           |\n"
+    "|                        |                                             |\n"
+    "|                        |                                             |\n"
+    "|                        |                                             |\n"
+    "|                        |                                             |\n"
+    "|                       *|*                                            |\n"
+    "|                      **|**                                           |\n"
+    "|                     ***|***                                          |\n"
+    "|                    ****|****                                         |\n"
+    "|                   *****|*****                                        |\n"
+    "|                  *************                                       |\n"
+    "|              +--------------------------------------+                |\n"
+    "|              |                                      |                |\n"
+    "|              |                                      |   1- Suspender |\n"
+    "+--------------+--------------------------------------+----------------+\n"
+    "| Opcao:                                                               |\n"
+    "+----------------------------------------------------------------------+\n"
+    "+--------------------+-------------------------------+-----------------+\n"
+    "| Tempo:             |                               |     Erradas:    |\n"
+    "+--------------------+       Ja se ve a cab...       |                 |\n"
+    "| Score:             |                               |                 |\n"
+    "+--------------------|                               |                 |\n"
+    "| Tema:              |                               |                 |\n"
+    "|--------------------+                               +-----------------+\n"
+    "|                                                                      |\n"
+    "|                        +----------------                             |\n"
+    "|                        |               |                             |\n"
+    "|                        |               |                             |\n"
+    "|                        |               |                             |\n"
+    "|                        |            @@@@@@                           |\n"
+    "|                        |           @      @                          |\n"
+    "|                        |           @      @                          |\n"
+    "|                        |            @@@@@@                           |\n"
+    "|                        |               |                             |\n"
+    "|                        |               +                             |\n"
+    "|                        |               |                             |\n"
+    "|                        |               |                             |\n"
+    "|                       *|*              +                             |\n"
+    "|                      **|**                                           |\n"
+    "|                     ***|***                                          |\n"
+    "|                    ****|****                                         |\n"
+    "|                   *****|*****                                        |\n"
+    "|                  *************                                       |\n"
+    "|              +--------------------------------------+                |\n"
+    "|              |                                      |                |\n"
+    "|              |                                      |   1- Suspender |\n"
+    "+--------------+--------------------------------------+----------------+\n"
+    "| Opcao:                                                               |\n"
+    "+----------------------------------------------------------------------+\n"
+    "+--------------------+-------------------------------+-----------------+\n"
+    "| Tempo:             |                               |     Erradas:    |\n"
+    "+--------------------+ Nem quero ver onde vai acabar |                 |\n"
+    "| Score:             |                               |                 |\n"
+    "+--------------------|                               |                 |\n"
+    "| Tema:              |                               |                 |\n"
+    "|--------------------+                               +-----------------+\n"
+    "|                                                                      |\n"
+    "|                        +----------------                             |\n"
+    "|                        |               |                             |\n"
+    "|                        |               |                             |\n"
+    "|                        |               |                             |\n"
+    "|                        |            @@@@@@                           |\n"
+    "|                        |           @      @                          |\n"
+    "|                        |           @      @                          |\n"
+    "|                        |            @@@@@@                           |\n"
+    "|                        |               |                             |\n"
+    "|                        |               +                             |\n"
+    "|                        |               |                             |\n"
+    "|                        |               |                             |\n"
+    "|                       *|*            +-+                             |\n"
+    "|                      **|**           |                               |\n"
+    "|                     ***|***         -+                               |\n"
+    "|                    ****|****                                         |\n"
+    "|                   *****|*****                                        |\n"
+    "|                  *************                                       |\n"
+    "|              +--------------------------------------+                |\n"
+    "|              |                                      |                |\n"
+    "|              |                                      |   1- Suspender |\n"
+    "+--------------+--------------------------------------+----------------+\n"
+    "| Opcao:                                                               |\n"
+    "+----------------------------------------------------------------------+\n"
+    "+--------------------+-------------------------------+-----------------+\n"
+    "| Tempo:             |                               |     Erradas:    |\n"
+    "+--------------------+      Ja parece um homem       |                 |\n"
+    "| Score:             |                               |                 |\n"
+    "+--------------------|                               |                 |\n"
+    "| Tema:              |                               |                 |\n"
+    "|--------------------+                               +-----------------+\n"
+    "|                                                                      |\n"
+    "|                        +----------------                             |\n"
+    "|                        |               |                             |\n"
+    "|                        |               |                             |\n"
+    "|                        |               |                             |\n"
+    "|                        |            @@@@@@                           |\n"
+    "|                        |           @      @                          |\n"
+    "|                        |           @      @                          |\n"
+    "|                        |            @@@@@@                           |\n"
+    "|                        |               |                             |\n"
+    "|                        |               +                             |\n"
+    "|                        |               |                             |\n"
+    "|                        |               |                             |\n"
+    "|                       *|*            +-+-+                           |\n"
+    "|                      **|**           |   |                           |\n"
+    "|                     ***|***         -+   +-                          |\n"
+    "|                    ****|****                                         |\n"
+    "|                   *****|*****                                        |\n"
+    "|                  *************                                       |\n"
+    "|              +--------------------------------------+                |\n"
+    "|              |                                      |                |\n"
+    "|              |                                      |   1- Suspender |\n"
+    "+--------------+--------------------------------------+----------------+\n"
+    "| Opcao:                                                               |\n"
+    "+----------------------------------------------------------------------+\n"
+    "+--------------------+-------------------------------+-----------------+\n"
+    "| Tempo:             |                               |     Erradas:    |\n"
+    "+--------------------+ Nao fales disto aos teus      |                 |\n"
+    "| Score:             | amigos..                      |                 |\n"
+    "+--------------------|                               |                 |\n"
+    "| Tema:              |                               |                 |\n"
+    "|--------------------+                               +-----------------+\n"
+    "|                                                                      |\n"
+    "|                        +----------------                             |\n"
+    "|                        |               |                             |\n"
+    "|                        |               |                             |\n"
+    "|                        |               |                             |\n"
+    "|                        |            @@@@@@                           |\n"
+    "|                        |           @      @                          |\n"
+    "|                        |           @      @                          |\n"
+    "|                        |            @@@@@@                           |\n"
+    "|                        |               |                             |\n"
+    "|                        |           ----+                             |\n"
+    "|                        |               |                             |\n"
+    "|                        |               |                             |\n"
+    "|                       *|*            +-+-+                           |\n"
+    "|                      **|**           |   |                           |\n"
+    "|                     ***|***         -+   +-                          |\n"
+    "|                    ****|****                                         |\n"
+    "|                   *****|*****                                        |\n"
+    "|                  *************                                       |\n"
+    "|              +--------------------------------------+                |\n"
+    "|              |                                      |                |\n"
+    "|              |                                      |   1- Suspender |\n"
+    "+--------------+--------------------------------------+----------------+\n"
+    "| Opcao:                                                               |\n"
+    "+----------------------------------------------------------------------+\n"
+    "+--------------------+-------------------------------+-----------------+\n"
+    "| Tempo:             |                               |     Erradas:    |\n"
+    "+--------------------+  Parece que a nossa historia  |                 |\n"
+    "| Score:             |          acaba aqui           |                 |\n"
+    "+--------------------|                               |                 |\n"
+    "| Tema:              |                               |                 |\n"
+    "|--------------------+                               +-----------------+\n"
+    "|                                                                      |\n"
+    "|                        +----------------                             |\n"
+    "|                        |               |                             |\n"
+    "|                        |               |                             |\n"
+    "|                        |               |                             |\n"
+    "|                        |            @@@@@@                           |\n"
+    "|                        |           @      @                          |\n"
+    "|                        |           @      @                          |\n"
+    "|                        |            @@@@@@                           |\n"
+    "|                        |               |                             |\n"
+    "|                        |           ----+----                         |\n"
+    "|                        |               |                             |\n"
+    "|                        |               |                             |\n"
+    "|                       *|*            +-+-+                           |\n"
+    "|                      **|**           |   |                           |\n"
+    "|                     ***|***         -+   +-                          |\n"
+    "|                    ****|****                                         |\n"
+    "|                   *****|*****                                        |\n"
+    "|                  *************                                       |\n"
+    "|              +--------------------------------------+                |\n"
+    "|              |                                      |                |\n"
+    "|              |                                      |   1- Suspender |\n"
+    "+--------------+--------------------------------------+----------------+\n"
+    "| Opcao:                                                               |\n"
+    "+----------------------------------------------------------------------+\n"
+    "+--------------------+-------------------------------+-----------------+\n"
+    "| Tempo:             |                               |     Erradas:    |\n"
+    "+--------------------+    (Pressione 4 para sair)    |                 |\n"
+    "| Score:             |                               |                 |\n"
+    "+--------------------|                               |                 |\n"
+    "| Tema:              |                               |                 |\n"
+    "|--------------------+                               +-----------------+\n"
+    "|                        Parabens, venceste!                           |\n"
+    "|                    +-------------------------+                       |\n"
+    "|                    |    Resumo da Partida    |                       |\n"
+    "|                    |                         |                       |\n"
+    "|                    +-------------------------+                       |\n"
+    "|                    |                         |                       |\n"
+    "|                    | Score:                  |                       |\n"
+    "|                    |                         |                       |\n"
+    "|                    |                         |                       |\n"
+    "|                    |                         |                       |\n"
+    "|                    | Erros:                  |                       |\n"
+    "|                    |                         |                       |\n"
+    "|                    |                         |                       |\n"
+    "|                    |                         |                       |\n"
+    "|                    | Tempo:                  |                       |\n"
+    "|                    |                         |                       |\n"
+    "|                    |                         |                       |\n"
+    "|                    +-------------------------+                       |\n"
+    "|                                                                      |\n"
+    "|              +--------------------------------------+                |\n"
+    "|              |                                      |                |\n"
+    "|              |                                      |                |\n"
+    "+--------------+--------------------------------------+----------------+\n"
+    "| Opcao:                                                               |\n"
+    "+----------------------------------------------------------------------+\n"
+    "+--------------------+-------------------------------+-----------------+\n"
+    "| Tempo:             |                               |     Erradas:    |\n"
+    "+--------------------+    (Pressione 4 para sair)    |                 |\n"
+    "| Score:             |                               |                 |\n"
+    "+--------------------|                               |                 |\n"
+    "| Tema:              |                               |                 |\n"
+    "|--------------------+                               +-----------------+\n"
+    "|                                                                      |\n"
+    "|   xxxxxxxx     xxxxxxxx   xx    xx xxxxxx                            |\n"
+    "|   x            x      x   xx    xx xxxxxx                            |\n"
+    "|   x            x      x   xxx  xxx x                                 |\n"
+    "|   x            xxxxxxxx   x xxxx x xxxxxx                            |\n"
+    "|   x    xxxxx   x      x   x  xx  x xxxxxx                            |\n"
+    "|   x        x   x      x   x      x x                                 |\n"
+    "|   x        x   x      x   x      x xxxxxx                            |\n"
+    "|   xxxxxxxxxx   x      x   x      x xxxxxx                            |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|               xxxxxxxxxxx   xx        xx  xxxxxxxx    xxxxx          |\n"
+    "|              x           x  xx        xx  xxxxxxxx    xx  xx         |\n"
+    "|              x           x  xx        xx  xx          xx  xx         |\n"
+    "|              x           x   xx      xx   xxxxxxxx    xxxxx          |\n"
+    "|              x           x    xx    xx    xxxxxxxx    xxxxx          |\n"
+    "|              x           x     xx  xx     xx          xx  xx         |\n"
+    "|              x           x       xxx      xxxxxxxx    xx   xx        |\n"
+    "|                xxxxxxxxxx         x       xxxxxxxx    xx    xx       |\n"
+    "|              +--------------------------------------+                |\n"
+    "|              |                                      |                |\n"
+    "|              |                                      |                |\n"
+    "+--------------+--------------------------------------+----------------+\n"
+    "| Opcao:                                                               |\n"
+    "+----------------------------------------------------------------------+\n"
+    "+----------------------------------------------------------------------+\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                        Configuracao de Temas                         |\n"
+    "|                 +---------------------------------+                  |\n"
+    "|                 |                                 |                  |\n"
+    "|                 |     1- Adicionar                |                  |\n"
+    "|                 |                                 |                  |\n"
+    "|                 |     2- Modificar                |                  |\n"
+    "|                 |                                 |                  |\n"
+    "|                 |     3- Remover                  |                  |\n"
+    "|                 +---------------------------------+                  |\n"
+    "|                 |     4- Voltar ao Menu           |                  |\n"
+    "|                 +---------------------------------+                  |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "+----------------------------------------------------------------------+\n"
+    "| Opcao:                                                               |\n"
+    "+----------------------------------------------------------------------+\n"
+    "+----------------------------------------------------------------------+\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                        Configuracao de Temas                         |\n"
+    "|                 +---------------------------------+                  |\n"
+    "|                 |                                 |                  |\n"
+    "|                 | Introduz o nome do tema para    |                  |\n"
+    "|                 | continuar.                      |                  |\n"
+    "|                 |                                 |                  |\n"
+    "|                 |                                 |                  |\n"
+    "|                 +---------------------------------+                  |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "|                                                                      |\n"
+    "+----------------------------------------------------------------------+\n"
+    "| Opcao:                                                               |\n"
+    "+----------------------------------------------------------------------+\n"
+    "+----------------------------------------------------------------------+\n"
+    "|                                                                      |\n"
+    "|   +---------------------------------+---+------------------------+   |\n"
+    "|   |                                 |   |                        |   |\n"
+    "|   | Tema     :                      |   |                        |   |\n"
+    "|   |                                 |---|------------------------|   |\n"
+    "|   | Palavras :                      |   |                        |   |\n"
+    "|   |                                 |   |                        |   |\n"
+    "|   | Cada tema deve ter no minimo    |---|------------------------|   |\n"
+    "|   | 8 palavras, e cada palavra com  |   |                        |   |\n"
+    "|   | pelo menos 3 carateres.         |   |                        |   |\n"
+    "|   |                                 |---|------------------------|   |\n"
+    "|   |                                 |   |                        |   |\n"
+    "|   |                                 |   |                        |   |\n"
+    "|   |                                 |---|------------------------|   |\n"
+    "|   |                                 |   |                        |   |\n"
+    "|   |                                 |   |                        |   |\n"
+    "|   |                                 |---|------------------------|   |\n"
+    "|   |                                 |   |                        |   |\n"
+    "|   |                                 |   |                        |   |\n"
+    "|   |---------------------------------|---|------------------------|   |\n"
+    "|   |      1- Adicionar Palavra       |   |                        |   |\n"
+    "|   |                                 |   |                        |   |\n"
+    "|   |      2- Remover Palavra         |---|------------------------|   |\n"
+    "|   |                                 |   |                        |   |\n"
+    "|   |      3- Voltar ao Menu          |   |                        |   |\n"
+    "|   +---------------------------------+---+------------------------+   |\n"
+    "|   |                                 |   |  4- Subir   5- Descer  |   |\n"
+    "|   +--------------------------------------------------------------+   |\n"
+    "+----------------------------------------------------------------------+\n"
+    "| Opcao:                                                               |\n"
+    "+----------------------------------------------------------------------+\n"
+    "";
+
+inline constexpr char embedded_themes[] =
+    "4\n"
+    "9\n"
+    "alimentos 0\n"
+    "noz 1\n"
+    "uva 1\n"
+    "couve 1\n"
+    "picle 2\n"
+    "azeite 1\n"
+    "cenoura 1\n"
+    "tomate 2\n"
+    "broculos 1\n"
+    "10\n"
+    "marcas 0\n"
+    "bmw 14\n"
+    "google 12\n"
+    "sony 11\n"
+    "cocacola 12\n"
+    "adidas 11\n"
+    "microsoft 13\n"
+    "corona 12\n"
+    "netflix 10\n"
+    "mcdonalds 13\n"
+    "10\n"
+    "eletro 0\n"
+    "eda 1\n"
+    "amii 2\n"
+    "vitor 2\n"
+    "etica 1\n"
+    "circuito 3\n"
+    "multimetro 1\n"
+    "programacao 1\n"
+    "ohmimetro 2\n"
+    "deec 1\n"
+    "9\n"
+    "arvores 0\n"
+    "macieira 1\n"
+    "laranjeiro 2\n"
+    "pereira 1\n"
+    "figueira 1\n"
+    "carvalho 1\n"
+    "oliveira 1\n"
+    "cerejeira 1\n"
+    "pessegueiro 1\n"
+    "";
+
+static_assert(sizeof(embedded_images) - 1 == embedded_image_count * embedded_image_width * embedded_image_height);
+
+#endif
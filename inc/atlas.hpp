@@ -0,0 +1,42 @@
+#ifndef ATLAS_HPP
+#define ATLAS_HPP
+
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include "io.hpp"
+
+/*
+    Tabela de imagens de texto. O ficheiro é mapeado em memória uma única vez e cada
+    imagem é devolvida como uma vista sobre esse bloco, sem cópias.
+*/
+class atlas {
+private:
+    const char* data;
+    size_t size;
+    int count;
+    mappedfile file;
+
+    void release();
+    bool validate(std::string filename);
+
+public:
+    static const int image_width = 73;
+    static const int image_height = 32;
+    static const int image_size = image_width * image_height;
+
+    atlas();
+    ~atlas();
+
+    atlas(const atlas&) = delete;
+    atlas& operator=(const atlas&) = delete;
+
+    bool load(std::string filename);
+    bool load(std::string_view buffer, std::string name);
+
+    std::string_view getImage(int index) const;
+    int getImageCount() const;
+};
+
+#endif
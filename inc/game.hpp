@@ -6,61 +6,134 @@
 #include <iomanip>
 
 #include <algorithm>
-#include <unordered_set>
+#include <unordered_map>
 #include <string>
 #include <list>
+#include <vector>
+#include <memory>
 
 #include <chrono>
 #include <thread>
 
-#if defined(_WIN32)
-#include <windows.h>
-#endif
-
+#include "atlas.hpp"
+#include "screen.hpp"
+#include "input.hpp"
 #include "player.hpp"
+#include "playerindex.hpp"
+#include "playerstore.hpp"
+#include "playertable.hpp"
+#include "ranking.hpp"
+#include "roundstate.hpp"
+#include "solver.hpp"
+#include "themecatalog.hpp"
+#include "writer.hpp"
 #include "io.hpp"
 #include "mathutils.hpp"
 
-typedef struct {
-    std::string word;
-    int occurences;
-} word_info;
+/*
+    Opções de execução do jogo, definidas na linha de comandos ou por variáveis de ambiente.
+*/
+struct game_options {
+    // Duração (ms) da animação de seleção; 0 desativa a animação.
+    int selection_delay = 800;
+    // Ficheiro de imagens a utilizar em vez das imagens embutidas.
+    std::string images_filename = "";
+    // Origem do input; por omissão é utilizado o terminal.
+    input_source* input = nullptr;
+    // Ficheiro onde gravar a sessão interativa, para reprodução posterior.
+    std::string record_filename = "";
+    // Descartar todo o output (ex. reprodução de sessões).
+    bool null_output = false;
+    // Guardar os jogadores no ficheiro binário "players.bin" em vez de "players.txt".
+    bool binary_store = false;
+    // Carregar cada jogador de "players.txt" apenas quando for necessário.
+    bool lazy_loading = false;
+    // Sugerir a próxima letra durante a ronda.
+    bool hints = false;
+    // Semente do gerador aleatório, para repetir os mesmos sorteios. Sem "has_seed" (nenhuma
+    // semente indicada) é utilizado o relógio; qualquer valor, incluindo 0, é uma semente válida.
+    bool has_seed = false;
+    uint64_t seed = 0;
+};
 
 class game {
+    // Acesso aos métodos internos para os benchmarks (bench/bench.cpp).
+    friend class benchmark;
+
 private:
     // Manutenção de estado
 	bool running;
 	int state;
+    game_options options;
 
     // Renderização
-    std::string images;
+    atlas images;
+    screen terminal;
     int start_of_page;
 
-    std::string getImageAtIndex(int index);
-    void setCursorPos(int x, int y); 
-    void setSelectionDelay(int x, int y, int delay);
+    void loadImageData();
+    std::string_view getImageAtIndex(int index);
+    void stamp(int x, int y, std::string_view text);
+    void commit(int x, int y);
+    void setSelectionDelay(int x, int y);
 
     // Jogadores
     std::string active_username;
-    std::list<player> players;
-
-    player& getPlayerFromUsername(std::string __username);
+    player_handle active_handle;
+    player active;
+    playertable players;
+    ranking leaderboard;
+    bool leaderboard_ready;
+
+    playerindex index;
+
+    player_handle getPlayerFromUsername(std::string __username);
+    player& getActivePlayer();
+    void syncActivePlayer();
+    player_handle addPlayer(const player& __player);
+    ranking& getLeaderboard();
+    void updateRanking(player_handle handle);
+    void markPlayerLoaded(const std::string& __username);
     
-    // Persistência de dados
+    // Persistência de dados, gravada em segundo plano
+    writer persistence;
+    size_t journal_entries;
+    playerstore store;
+    // Último erro ao gravar em "players.bin", apresentado no fim do jogo e não a meio do ecrã.
+    std::string store_error;
+
     void savePlayerData();
+    void updatePlayerData(player& __player);
+    void writePlayerRecord(player& __player, player_handle handle);
     void loadPlayerData();
 
     // Alteração de temas
-    std::list<std::list<word_info>> themes;
+    themecatalog themes;
+
+    theme_info& getThemeFromName(string_id __theme);
 
-    std::list<word_info>& getThemeFromName(std::string __theme);
+    int theme_changes;
+    std::chrono::time_point<std::chrono::steady_clock> theme_flush_time;
 
     void saveThemeData();
+    void flushThemeData(bool force);
     void loadThemeData();
 
-    std::string selectRandomWord(std::string theme);
+    // Sorteios do jogo (palavras e temas), com a semente das opções
+    xoshiro256 generator;
+
+    string_id selectRandomWord(string_id theme);
+
+    // Sugestões durante a ronda, com o índice do último tema utilizado
+    solver hint_solver;
+    string_id hint_theme;
+
+    char getHint(string_id theme, const roundstate& round);
 
     // Controlo do utilizador
+    std::unique_ptr<input_source> terminal_source;
+    input_source* input;
+
     std::string getUserInput();
 
     // Atores de estado
@@ -76,14 +149,16 @@ private:
     int configActor();
 
 public:
-	game();
+	game(game_options __options = game_options());
 	~game();
 
-    void render(std::string framebuffer, bool clearscreen = true);
+    void render(std::string_view framebuffer);
     void run();
 
 };
 
+bool loadThemeCatalog(themecatalog& themes, std::string& error);
+
 enum game_state {
     GAME_STATE_ERROR,
     GAME_STATE_RESET,
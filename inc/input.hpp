@@ -0,0 +1,64 @@
+#ifndef INPUT_HPP
+#define INPUT_HPP
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+
+/*
+    Origem do input do utilizador. Cada chamada a "next" devolve uma palavra (token),
+    equivalente a uma leitura "std::cin >> token"; devolve falso quando não houver mais input.
+*/
+class input_source {
+public:
+    virtual ~input_source() {}
+
+    virtual bool next(std::string& token) = 0;
+};
+
+/*
+    Input interativo através do terminal. Opcionalmente grava cada token num ficheiro de
+    sessão, que pode depois ser reproduzido com "file_input".
+*/
+class terminal_input : public input_source {
+private:
+    std::ofstream record;
+
+public:
+    terminal_input(std::string record_filename = "");
+
+    bool next(std::string& token) override;
+};
+
+/*
+    Input a partir de uma lista de tokens em memória.
+*/
+class script_input : public input_source {
+private:
+    std::vector<std::string> tokens;
+    size_t position;
+
+public:
+    script_input(std::vector<std::string> __tokens);
+
+    bool next(std::string& token) override;
+};
+
+/*
+    Input a partir de um ficheiro de sessão gravado (um token por linha).
+*/
+class file_input : public input_source {
+private:
+    std::ifstream file;
+
+public:
+    file_input(std::string filename);
+
+    bool is_open() const;
+    bool next(std::string& token) override;
+};
+
+bool loadSessionFile(std::string filename, std::vector<std::string>& tokens);
+
+#endif
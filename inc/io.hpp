@@ -5,9 +5,80 @@
 #include <fstream>
 #include <sstream>
 #include <string>
+#include <string_view>
 
-std::stringstream getFileData(std::string filename);
+/*
+    Vista só de leitura sobre o conteúdo de um ficheiro. Sempre que possível o ficheiro é
+    mapeado em memória e lido diretamente, sem cópias; caso contrário (ex. Windows) é lido
+    para um bloco próprio. A vista é válida enquanto o ficheiro estiver aberto.
+*/
+class mappedfile {
+private:
+    const char* address;
+    size_t length;
+    bool mapped;
+    std::string fallback;
+    std::string last_error;
 
-void setFileData(std::string filename, std::stringstream& data);
+    bool fail(std::string message);
 
-#endif
\ No newline at end of file
+public:
+    mappedfile();
+    ~mappedfile();
+
+    mappedfile(const mappedfile&) = delete;
+    mappedfile& operator=(const mappedfile&) = delete;
+
+    bool open(std::string filename);
+    void close();
+
+    std::string_view view() const;
+    const std::string& error() const;
+};
+
+/*
+    Escritor de ficheiros com um bloco intermédio. Os dados pequenos são acumulados no bloco e
+    os grandes são escritos diretamente a partir do bloco de quem os entrega, sem cópias.
+
+    Ao substituir um ficheiro, os dados são escritos num ficheiro temporário que só substitui
+    o original em "close", depois de sincronizado com o disco. Um escritor destruído sem
+    "close" descarta o temporário e o ficheiro original fica intacto.
+*/
+class filewriter {
+private:
+    int fd;
+    std::ofstream stream;
+    std::string filename;
+    std::string temporary;
+    bool appending;
+    std::string buffer;
+    std::string last_error;
+
+    bool fail(std::string message);
+    bool writeDirect(std::string_view data);
+
+public:
+    static const size_t buffer_size = 64 * 1024;
+
+    filewriter();
+    ~filewriter();
+
+    filewriter(const filewriter&) = delete;
+    filewriter& operator=(const filewriter&) = delete;
+
+    bool open(std::string __filename, bool append = false);
+    bool write(std::string_view data);
+    bool flush();
+    bool close();
+    void discard();
+
+    const std::string& error() const;
+};
+
+bool hasFileData(std::string filename);
+
+bool replaceFileData(std::string filename, std::string_view data);
+
+bool appendFileData(std::string filename, std::string_view data);
+
+#endif
@@ -2,6 +2,7 @@
 #define MATHUTILS_HPP
 
 #include <cmath>
+#include <cstdint>
 
 inline double map(double x, double a, double b, double c, double d) {
     return (x - a) * (d - c) / (b - a) + c;
@@ -11,9 +12,102 @@ inline double lerp(double x, double a, double b) {
     return x + (a - x) * b;
 }
 
-// Gerar um inteiro aleatório num intervalo [lower, upper]
-inline int randi(int lower, int upper) {
-    return map(rand(), 0.0, RAND_MAX, lower, upper);
+/*
+    Gerador aleatório xoshiro256** (https://prng.di.unimi.it), pequeno e rápido, para ser
+    utilizado por um único jogo ou thread. Com a mesma semente gera sempre a mesma sequência;
+    "stream" permite obter sequências independentes a partir da mesma semente (ex. uma sessão
+    de uma simulação). O estado é iniciado com o splitmix64, como recomendado pelos autores:
+    a semente é dispersa e "stream" é misturado no estado do splitmix64, que gera depois as
+    quatro palavras do estado, pelo que (semente, stream) e (stream, semente) são diferentes.
+
+    Pode ser utilizado com as distribuições de <random>, mas "bounded" e "real" não dependem
+    da biblioteca, pelo que os resultados são os mesmos em qualquer plataforma.
+*/
+class xoshiro256 {
+private:
+    uint64_t state[4];
+
+    static uint64_t rotate(uint64_t value, int bits) {
+        return (value << bits) | (value >> (64 - bits));
+    }
+
+    static uint64_t splitmix(uint64_t& value) {
+        uint64_t result = (value += 0x9E3779B97F4A7C15ULL);
+        result = (result ^ (result >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        result = (result ^ (result >> 27)) * 0x94D049BB133111EBULL;
+        return result ^ (result >> 31);
+    }
+
+public:
+    typedef uint64_t result_type;
+
+    static constexpr result_type min() {
+        return 0;
+    }
+
+    static constexpr result_type max() {
+        return UINT64_MAX;
+    }
+
+    xoshiro256(uint64_t value = 0, uint64_t stream = 0) {
+        seed(value, stream);
+    }
+
+    void seed(uint64_t value, uint64_t stream = 0) {
+        uint64_t mixer = splitmix(value) ^ stream;
+        for (uint64_t& word : this->state) {
+            word = splitmix(mixer);
+        }
+        // O estado não pode ser todo 0.
+        if ((this->state[0] | this->state[1] | this->state[2] | this->state[3]) == 0) {
+            this->state[0] = 1;
+        }
+    }
+
+    uint64_t next() {
+        uint64_t result = rotate(this->state[1] * 5, 7) * 9;
+        uint64_t shifted = this->state[1] << 17;
+
+        this->state[2] ^= this->state[0];
+        this->state[3] ^= this->state[1];
+        this->state[1] ^= this->state[2];
+        this->state[0] ^= this->state[3];
+        this->state[2] ^= shifted;
+        this->state[3] = rotate(this->state[3], 45);
+
+        return result;
+    }
+
+    uint64_t operator()() {
+        return next();
+    }
+
+    /*
+        Inteiro em [0, range), sem enviesamento: multiplicação de 128 bits, rejeitando os
+        poucos valores que dariam mais peso a alguns resultados (método de Lemire).
+    */
+    uint64_t bounded(uint64_t range) {
+        __uint128_t product = (__uint128_t)next() * range;
+        uint64_t low = (uint64_t)product;
+        if (low < range) {
+            uint64_t threshold = -range % range;
+            while (low < threshold) {
+                product = (__uint128_t)next() * range;
+                low = (uint64_t)product;
+            }
+        }
+        return product >> 64;
+    }
+
+    // Real em [0, 1), com os 53 bits de precisão de um double.
+    double real() {
+        return (next() >> 11) * 0x1.0p-53;
+    }
+};
+
+// Gerar um inteiro aleatório num intervalo [lower, upper], com ambos os limites incluídos
+inline int randi(xoshiro256& generator, int lower, int upper) {
+    return lower + (int64_t)generator.bounded((uint64_t)((int64_t)upper - lower) + 1);
 }
 
 #endif
@@ -0,0 +1,39 @@
+#ifndef PARSER_HPP
+#define PARSER_HPP
+
+#include <string>
+#include <string_view>
+
+/*
+    Leitor dos ficheiros de texto do jogo ("players.txt", "themes.txt" e "players.journal").
+
+    Os campos são separados por espaços ou mudanças de linha, tal como eram lidos através dos
+    operadores ">>" de um stringstream, mas são devolvidos como vistas sobre o próprio texto,
+    sem cópias. Os números são convertidos com "std::from_chars" e um campo que não seja
+    inteiramente um número válido é reportado como erro, indicando a linha onde se encontra.
+*/
+class textparser {
+private:
+    std::string_view data;
+    std::string name;
+    size_t position;
+    int line;
+    std::string last_error;
+
+    bool fail(std::string_view field, std::string message);
+
+public:
+    textparser(std::string_view __data, std::string __name, int __line = 1);
+
+    bool nextToken(std::string_view& token, std::string_view field);
+    bool nextToken(std::string_view& token, std::string_view field, size_t max_length);
+    bool nextInt(int& value, std::string_view field);
+    bool nextInt(long long& value, std::string_view field);
+    bool nextFloat(float& value, std::string_view field);
+    bool atEnd();
+
+    size_t getPosition() const;
+    const std::string& error() const;
+};
+
+#endif
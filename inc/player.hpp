@@ -4,6 +4,10 @@
 #include <sstream>
 #include <string>
 #include <cstring>
+#include <functional>
+
+#include "parser.hpp"
+#include "stringpool.hpp"
 
 enum gamemode_persistent {
     GAMEMODE_SIMPLE,
@@ -19,6 +23,9 @@ enum difficulty_persistent {
     DIFFICULTY_HARD
 };
 
+// Tamanho máximo do nome de um jogador (também limitado pelo registo de "players.bin").
+static const size_t max_username_length = 14;
+
 class player {
 public:
 	// Persistent data
@@ -29,21 +36,26 @@ public:
     float time_persistent;
     int gamemode_persistent;
     int difficulty_persistent;
-    std::string theme_persistent;
+    string_id theme_persistent;
 	// Runtime data
     int gamemode_runtime;
     int difficulty_runtime;
-    std::string theme_runtime;
+    string_id theme_runtime;
 	int score_runtime;
 	int time_runtime;
     std::string hidden_word;
     std::string attempts;
+    // Posição do registo no ficheiro binário de jogadores (-1 se ainda não existir)
+    int store_index;
 
     player(std::string __username = "none");
     ~player();
 
     player& fromRawPlayerData(std::stringstream& data);
+    bool parseRawPlayerData(textparser& data);
     player& toRawPlayerData(std::stringstream& data);
 };
 
+bool readPlayerJournal(std::string filename, const std::function<void(const player&)>& apply, std::string& error);
+
 #endif
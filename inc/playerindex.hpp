@@ -0,0 +1,56 @@
+#ifndef PLAYERINDEX_HPP
+#define PLAYERINDEX_HPP
+
+#include <iostream>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unordered_map>
+
+#include "player.hpp"
+
+typedef struct {
+    std::string username;
+    size_t offset;
+    size_t length;
+    int score;
+    // O jogador já foi carregado para memória e os dados do índice deixaram de ser atuais.
+    bool loaded;
+} player_entry;
+
+/*
+    Índice dos registos de "players.txt": para cada jogador guarda a posição e o tamanho do
+    seu registo no ficheiro, e a pontuação necessária para a tabela de pontuações.
+    Permite carregar um jogador apenas quando é necessário, sem interpretar o ficheiro inteiro.
+
+    O índice é guardado num ficheiro próprio ("players.idx"), acompanhado do tamanho e da data
+    de modificação de "players.txt", e reconstruído sempre que estes deixem de corresponder.
+*/
+class playerindex {
+private:
+    std::string filename;
+    std::string index_filename;
+    std::vector<player_entry> entries;
+    std::unordered_map<std::string, size_t> positions;
+
+    bool loadIndexFile();
+    bool scan(std::string_view data);
+
+public:
+    bool build(std::string __filename, std::string __index_filename);
+    bool assign(std::string_view data);
+    bool save();
+
+    player_entry* find(const std::string& username);
+    bool read(const player_entry& entry, player& target);
+    bool readRaw(const player_entry& entry, std::string& raw);
+    bool readUnloaded(const std::function<void(std::string_view raw)>& function);
+
+    std::vector<player_entry>& getEntries();
+    size_t size() const;
+};
+
+#endif
@@ -0,0 +1,86 @@
+#ifndef PLAYERSTORE_HPP
+#define PLAYERSTORE_HPP
+
+#include <iostream>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "player.hpp"
+#include "playertable.hpp"
+
+/*
+    Ficheiro binário de jogadores com registos de tamanho fixo ("players.bin").
+
+    [cabeçalho][tabela de temas][registo 0][registo 1]...
+
+    Os temas são guardados uma única vez na tabela e referidos nos registos pelo seu índice.
+    Em memória, a tabela guarda os identificadores dos temas no conjunto de textos.
+    Cada registo pode ser atualizado com uma única escrita na sua posição, sem reescrever os
+    restantes. Os valores são guardados na ordem de bytes nativa.
+*/
+
+struct playerstore_header {
+    char magic[8];
+    uint32_t version;
+    uint32_t record_size;
+    uint32_t record_count;
+    uint32_t theme_count;
+};
+
+struct playerstore_record {
+    char username[16];
+    int32_t score_persistent;
+    int32_t rounds_persistent;
+    int32_t fails_persistent;
+    float time_persistent;
+    int32_t gamemode_persistent;
+    int32_t difficulty_persistent;
+    uint16_t theme_persistent;
+    uint16_t reserved;
+    int32_t score_runtime;
+    int32_t time_runtime;
+    char hidden_word[32];
+    char attempts[32];
+};
+
+class playerstore {
+private:
+    int fd;
+    playerstore_header header;
+    std::vector<string_id> themes;
+    std::string last_error;
+
+    bool fail(std::string message);
+    bool writeHeader();
+    bool writeTheme(uint16_t index);
+    bool internTheme(string_id theme, uint16_t& index);
+    bool encode(const player& source, playerstore_record& record);
+    void decode(const playerstore_record& record, player& target);
+
+public:
+    static const uint32_t version = 1;
+    static const uint32_t theme_capacity = 256;
+    static const size_t theme_size = 16;
+    static const size_t header_size = 64;
+    static const size_t records_offset = header_size + theme_capacity * theme_size;
+
+    playerstore();
+    ~playerstore();
+
+    playerstore(const playerstore&) = delete;
+    playerstore& operator=(const playerstore&) = delete;
+
+    bool open(std::string filename, bool truncate = false, bool read_only = false);
+    void close();
+
+    bool load(playertable& players);
+    bool write(player& target);
+
+    size_t size() const;
+    const std::string& error() const;
+};
+
+bool convertPlayerData(std::string source, std::string destination);
+
+#endif
@@ -0,0 +1,73 @@
+#ifndef PLAYERTABLE_HPP
+#define PLAYERTABLE_HPP
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <deque>
+
+#include "player.hpp"
+#include "usernameindex.hpp"
+
+// Identificador estável de um jogador na tabela (a sua posição, que nunca muda).
+typedef uint32_t player_handle;
+
+static const player_handle invalid_player = UINT32_MAX;
+
+/*
+    Dados de um jogador raramente percorridos em conjunto: o nome, as preferências e o estado
+    do jogo em curso. Cada registo conhece a sua posição na tabela.
+*/
+typedef struct {
+    std::string username;
+    player_handle handle;
+    int gamemode_persistent;
+    int difficulty_persistent;
+    string_id theme_persistent;
+    int gamemode_runtime;
+    int difficulty_runtime;
+    string_id theme_runtime;
+    int score_runtime;
+    int time_runtime;
+    std::string hidden_word;
+    std::string attempts;
+    int store_index;
+} player_details;
+
+/*
+    Tabela de jogadores organizada por colunas. As estatísticas percorridas para todos os
+    jogadores (pontuação, jogos, falhas e tempo) ficam em vetores contíguos próprios, separadas
+    dos textos de cada jogador, que ficam em blocos contíguos de registos.
+
+    Os jogadores nunca são removidos, pelo que a posição de cada um serve de identificador
+    estável ("player_handle"). Para alterar um jogador obtém-se uma cópia com "get" e
+    guarda-se com "set".
+*/
+class playertable {
+private:
+    std::vector<int> scores;
+    std::vector<int> rounds;
+    std::vector<int> fails;
+    std::vector<float> times;
+    std::deque<player_details> details;
+    usernameindex<player_details> usernames;
+
+public:
+    player_handle add(const player& source);
+    player_handle find(std::string_view username) const;
+
+    void get(player_handle handle, player& target) const;
+    void set(player_handle handle, const player& source);
+    void setStoreIndex(player_handle handle, int store_index);
+
+    const std::string& getUsername(player_handle handle) const;
+    int getScore(player_handle handle) const;
+    int getStoreIndex(player_handle handle) const;
+
+    void reserve(size_t capacity);
+    void clear();
+    size_t size() const;
+};
+
+#endif
@@ -0,0 +1,74 @@
+#ifndef RANKING_HPP
+#define RANKING_HPP
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <deque>
+
+#include "usernameindex.hpp"
+
+typedef struct {
+    std::string username;
+    int score;
+} leaderboard_entry;
+
+/*
+    Tabela de pontuações mantida sempre ordenada, numa skip list indexável: cada ligação guarda
+    quantas posições avança, o que permite chegar à posição "k" ou obter a posição de um
+    jogador em O(log n), sem ordenar todos os jogadores a cada consulta.
+
+    Os jogadores são ordenados pela pontuação, da maior para a menor. Em caso de empate fica
+    primeiro o jogador inserido há mais tempo.
+
+    Os nós e as suas ligações são guardados em blocos contíguos e nunca são libertados um a
+    um: quando a pontuação de um jogador muda, o seu nó é retirado e ligado de novo.
+*/
+class ranking {
+private:
+    static const int max_levels = 32;
+
+    typedef struct {
+        std::string username;
+        int score;
+        uint64_t sequence;
+        size_t first_link;
+        int level_count;
+    } node;
+
+    typedef struct {
+        node* next;
+        size_t span;
+    } link;
+
+    std::deque<node> nodes;
+    std::vector<link> links;
+    usernameindex<node> positions;
+
+    node* head;
+    int levels;
+    size_t count;
+    uint64_t random_state;
+
+    node* createNode(std::string username, int score, int level_count);
+    link& linkAt(const node* target, int level);
+    const link& linkAt(const node* target, int level) const;
+    int randomLevel();
+    static bool before(const node* n1, int score, uint64_t sequence);
+    void attach(node* target);
+    void detach(node* target);
+
+public:
+    ranking();
+
+    void assign(std::vector<leaderboard_entry> entries);
+    void update(const std::string& username, int score);
+    void clear();
+
+    std::vector<leaderboard_entry> page(size_t start, size_t length) const;
+    long rank(const std::string& username) const;
+    size_t size() const;
+};
+
+#endif
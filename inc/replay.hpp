@@ -0,0 +1,10 @@
+#ifndef REPLAY_HPP
+#define REPLAY_HPP
+
+#include <string>
+
+#include "game.hpp"
+
+int runReplay(game_options options, std::string session_filename, int sessions);
+
+#endif
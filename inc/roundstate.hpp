@@ -0,0 +1,88 @@
+#ifndef ROUNDSTATE_HPP
+#define ROUNDSTATE_HPP
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "mathutils.hpp"
+#include "player.hpp"
+#include "wordmetadata.hpp"
+
+// Número de falhas que termina a ronda.
+static const int max_round_fails = 9;
+
+// Multiplicador da pontuação de cada dificuldade ("difficulty_persistent").
+inline int getDifficultyMultiplier(int difficulty) {
+    return (difficulty == DIFFICULTY_EASY) * 3
+        + (difficulty == DIFFICULTY_MEDIUM) * 5
+        + (difficulty == DIFFICULTY_HARD) * 8;
+}
+
+// Pontuação da ronda após uma tentativa: as letras certas e o bónus do tempo que a tentativa
+// demorou (1 ponto se imediata, -0.5 aos 10 segundos), multiplicados pela dificuldade.
+inline double getRoundScore(int correct, float duration, int multiplier) {
+    return (correct + map(duration, 0, 10, 1, -0.5)) * multiplier;
+}
+
+enum guess_result {
+    GUESS_CORRECT,
+    GUESS_MISSING,
+    GUESS_REPEATED
+};
+
+/*
+    Estado de uma ronda: as letras da palavra secreta, as letras já tentadas, as certas e as
+    erradas, guardadas como conjuntos de bits. As posições de cada letra na palavra são
+    calculadas uma única vez, pelo que cada tentativa custa O(1) e só revela as posições da
+    letra tentada.
+
+    A palavra apresentada ("_ " por cada letra) e as letras erradas (pela ordem em que foram
+    tentadas) são atualizadas a cada tentativa, sem voltar a percorrer as anteriores.
+*/
+class roundstate {
+private:
+    std::string word;
+    // Letras reveladas em cada posição ('\0' nas posições por revelar).
+    std::string pattern;
+    std::string display;
+    std::string failed;
+
+    letter_set letters;
+    letter_set guessed;
+    letter_set correct;
+    letter_set missing;
+
+    // Posições de cada letra em "positions", de "first[letter]" até "first[letter + 1]".
+    std::array<uint32_t, 257> first;
+    std::vector<uint32_t> positions;
+
+    int fails;
+
+public:
+    roundstate();
+
+    void start(const std::string& __word);
+    void start(const std::string& __word, const word_metadata& metadata);
+    void replay(const std::string& attempts);
+    guess_result guess(char letter);
+
+    const std::string& getWord() const;
+    const std::string& getPattern() const;
+    const std::string& getDisplay() const;
+    const std::string& getFailed() const;
+
+    int getUnique() const;
+    int getCorrect() const;
+    int getFails() const;
+    bool isSolved() const;
+
+    const letter_set& getCorrectLetters() const;
+    const letter_set& getMissingLetters() const;
+
+    bool hasLetter(char letter) const;
+    bool wasGuessed(char letter) const;
+};
+
+#endif
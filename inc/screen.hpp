@@ -0,0 +1,48 @@
+#ifndef SCREEN_HPP
+#define SCREEN_HPP
+
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "atlas.hpp"
+
+/*
+    Framebuffer duplo do terminal. "back" guarda a imagem que está a ser composta e
+    "front" o que já se encontra no terminal; ao confirmar a imagem, apenas as diferenças
+    entre os dois são enviadas, através de sequências de posicionamento do cursor, numa
+    única escrita.
+*/
+class screen {
+private:
+    std::string front;
+    std::string back;
+    bool front_valid;
+    bool output_enabled;
+
+    int cursor_x;
+    int cursor_y;
+
+public:
+    static const int width = atlas::image_width - 1;
+    static const int height = atlas::image_height;
+
+    screen();
+    ~screen();
+
+    void load(std::string_view frame);
+    void stamp(int x, int y, std::string_view text);
+    void invalidate();
+    void setOutputEnabled(bool enabled);
+
+    void commit(int x, int y);
+};
+
+#endif
@@ -0,0 +1,94 @@
+#ifndef SIMULATOR_HPP
+#define SIMULATOR_HPP
+
+#include <array>
+#include <string>
+#include <vector>
+
+#include "mathutils.hpp"
+#include "roundstate.hpp"
+#include "solver.hpp"
+#include "themecatalog.hpp"
+#include "workpool.hpp"
+
+/*
+    Opções da simulação de rondas (modo "hangman-sim", "--sim" na linha de comandos).
+*/
+struct sim_options {
+    // Número de rondas a simular.
+    int rounds = 1000000;
+    // Número de threads; 0 utiliza uma thread por núcleo.
+    int threads = 0;
+    // Número de sessões independentes em que as rondas são repartidas. Dentro de cada sessão
+    // as ocorrências das palavras acumulam-se de ronda para ronda, como num jogo real.
+    int sessions = 64;
+    // Percentagem das tentativas em que o jogador simulado segue a sugestão do "solver";
+    // nas restantes tenta uma letra ao acaso.
+    int skill = 75;
+    // Semente dos geradores aleatórios.
+    uint64_t seed = 0;
+};
+
+typedef struct {
+    long long rounds;
+    long long wins;
+    long long score;
+    long long fails;
+    long long guesses;
+    long long time;
+} sim_totals;
+
+// Resultados de um tema: totais por dificuldade e número de vezes que cada palavra foi sorteada.
+typedef struct {
+    std::array<sim_totals, 3> difficulties;
+    std::vector<long long> draws;
+    long long resets;
+} sim_theme_stats;
+
+/*
+    Simulação de rondas sem interface, repartidas por todos os núcleos, para afinar os pesos
+    dos temas e o equilíbrio das dificuldades. Cada ronda sorteia um tema e uma dificuldade ao
+    acaso, escolhe a palavra com o sorteio pesado do jogo ("themecatalog::drawWord") e é
+    pontuada como em "roundActor".
+
+    As rondas são repartidas por sessões, executadas num "workpool". Cada sessão começa com as
+    ocorrências de "themes.txt" e acumula-as ao longo de todas as suas rondas, pelo que o
+    sorteio pesado evolui como ao longo de um jogo com essas rondas. Cada thread tem o seu
+    gerador, uma cópia das ocorrências das palavras e as suas estatísticas, juntas apenas no
+    fim; o que é partilhado (palavras e índices do "solver") só é lido. O gerador de cada
+    sessão é dado pela semente e pelo número da sessão, pelo que os resultados não dependem do
+    número de threads.
+*/
+class simulator {
+private:
+    typedef struct {
+        const std::string* name;
+        std::vector<const std::string*> texts;
+        std::vector<word_metadata> metadata;
+        solver hints;
+    } sim_theme;
+
+    struct alignas(64) sim_worker {
+        xoshiro256 generator;
+        std::vector<theme_info> themes;
+        std::vector<sim_theme_stats> stats;
+        roundstate round;
+    };
+
+    std::vector<theme_info> initial;
+    std::vector<sim_theme> themes;
+
+    void playSession(sim_worker& worker, const sim_options& options, size_t session, int rounds) const;
+    void playRound(sim_worker& worker, const sim_options& options) const;
+
+public:
+    void build(themecatalog& catalog, workpool& pool);
+    size_t size() const;
+    const std::string& getThemeName(size_t theme) const;
+
+    void run(const sim_options& options, workpool& pool, std::vector<sim_theme_stats>& stats) const;
+};
+
+int runSimulation(sim_options options);
+
+#endif
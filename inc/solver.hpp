@@ -0,0 +1,64 @@
+#ifndef SOLVER_HPP
+#define SOLVER_HPP
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "themecatalog.hpp"
+#include "wordmetadata.hpp"
+
+/*
+    Resolução automática de uma ronda: dadas as palavras de um tema, a palavra revelada e as
+    letras certas e erradas, sugerir a letra que melhor divide as palavras ainda possíveis
+    (a que maximiza a entropia da revelação).
+
+    As palavras são agrupadas pelo tamanho e, em cada grupo, cada par (posição, letra) e cada
+    letra têm um conjunto de bits com as palavras que os contêm. Filtrar as palavras possíveis
+    é uma sequência de interseções desses conjuntos, sem percorrer os textos. Só as palavras
+    que restam são percorridas para calcular a entropia de cada letra.
+
+    As palavras com mais de 64 letras não são indexadas. Depois de construído, o índice só é
+    lido, pelo que "suggest" pode ser utilizado por várias threads.
+*/
+class solver {
+private:
+    typedef std::vector<uint64_t> word_bits;
+
+    static constexpr uint32_t no_bits = UINT32_MAX;
+
+    /*
+        Os conjuntos de bits de um grupo ficam seguidos em "bits", com "blocks" blocos cada.
+        "at[position * 256 + letter]" e "contains[letter]" indicam o conjunto com as palavras
+        que têm a letra nessa posição ou que contêm a letra ("no_bits" se nenhuma).
+    */
+    typedef struct {
+        std::vector<std::string_view> words;
+        size_t blocks;
+        std::vector<uint64_t> bits;
+        std::vector<uint32_t> at;
+        std::vector<uint32_t> contains;
+        // Primeira sugestão, sem letras tentadas (calculada ao construir o índice).
+        char opening;
+    } length_group;
+
+    std::vector<length_group> groups;
+    size_t count = 0;
+
+    size_t filter(const length_group& group, std::string_view pattern,
+        const letter_set& correct, const letter_set& missing, word_bits& candidates) const;
+    char choose(const length_group& group, const word_bits& candidates, size_t candidate_count,
+        const letter_set& guessed) const;
+
+public:
+    static const size_t max_length = 64;
+
+    void build(const theme_info& theme);
+    void clear();
+    size_t size() const;
+
+    size_t candidates(std::string_view pattern, const letter_set& correct, const letter_set& missing) const;
+    char suggest(std::string_view pattern, const letter_set& correct, const letter_set& missing) const;
+};
+
+#endif
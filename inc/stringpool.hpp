@@ -0,0 +1,53 @@
+#ifndef STRINGPOOL_HPP
+#define STRINGPOOL_HPP
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <deque>
+#include <unordered_map>
+#include <shared_mutex>
+
+// Identificador de um texto guardado no conjunto de textos ("stringpool").
+typedef uint32_t string_id;
+
+// O texto vazio tem sempre o identificador 0.
+static const string_id empty_string = 0;
+
+/*
+    Conjunto de textos partilhado por todo o processo (nomes dos temas e palavras). Cada texto
+    é guardado uma única vez e identificado por um inteiro, pelo que comparar dois textos do
+    conjunto é comparar os seus identificadores.
+
+    Os textos nunca são removidos, e as referências obtidas com "lookup" mantêm-se válidas
+    durante toda a execução. Os métodos podem ser utilizados por várias threads.
+*/
+class stringpool {
+private:
+    std::deque<std::string> strings;
+    std::unordered_map<std::string_view, string_id> ids;
+    mutable std::shared_mutex mutex;
+
+public:
+    stringpool();
+
+    stringpool(const stringpool&) = delete;
+    stringpool& operator=(const stringpool&) = delete;
+
+    string_id intern(std::string_view value);
+    bool find(std::string_view value, string_id& id) const;
+    const std::string& lookup(string_id id) const;
+    size_t size() const;
+
+    static stringpool& global();
+};
+
+inline string_id internString(std::string_view value) {
+    return stringpool::global().intern(value);
+}
+
+inline const std::string& getString(string_id id) {
+    return stringpool::global().lookup(id);
+}
+
+#endif
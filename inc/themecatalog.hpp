@@ -0,0 +1,75 @@
+#ifndef THEMECATALOG_HPP
+#define THEMECATALOG_HPP
+
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unordered_map>
+
+#include "parser.hpp"
+#include "stringpool.hpp"
+#include "wordsampler.hpp"
+#include "wordmetadata.hpp"
+
+typedef struct {
+    string_id word;
+    int occurences;
+} word_info;
+
+// "sampler" guarda os pesos de "words" e tem de ser atualizado sempre que as palavras mudam.
+typedef struct {
+    string_id name;
+    std::vector<word_info> words;
+    wordsampler sampler;
+} theme_info;
+
+/*
+    Catálogo dos temas e das suas palavras. Os temas ficam num vetor, pela ordem em que são
+    carregados ou criados (a ordem de "themes.txt" e dos menus), e são encontrados pelo nome
+    através de uma tabela de dispersão. As palavras de cada tema ficam num vetor contíguo.
+
+    No ficheiro cada tema começa por uma linha com o seu nome e 0 ocorrências, contada no
+    número de palavras do tema; essa linha só existe no ficheiro.
+
+    As propriedades de cada palavra ("word_metadata") são calculadas quando a palavra entra
+    no catálogo e guardadas pelo identificador da palavra, uma única vez mesmo que a palavra
+    pertença a vários temas.
+*/
+class themecatalog {
+private:
+    std::vector<theme_info> themes;
+    std::unordered_map<string_id, size_t> positions;
+    // Propriedades indexadas pelo identificador da palavra ("length" -1 se ainda não existirem).
+    std::vector<word_metadata> metadata;
+
+    const word_metadata& describe(string_id word, std::string_view text);
+
+public:
+    // Tamanho máximo do nome de um tema e de uma palavra. Uma palavra tem de caber na linha da
+    // ronda ("_ " por cada letra) e ambos têm de caber nos registos de "players.bin".
+    static const size_t max_name_length = 15;
+    static const size_t max_word_length = 19;
+
+    theme_info* find(string_id name);
+    theme_info& add(string_id name);
+    bool remove(string_id name);
+
+    theme_info& operator[](size_t index);
+    size_t size() const;
+    void clear();
+
+    std::vector<theme_info>::iterator begin();
+    std::vector<theme_info>::iterator end();
+
+    const word_metadata& describe(string_id word);
+    const word_metadata* getMetadata(string_id word) const;
+
+    bool parse(textparser& data);
+    void write(std::stringstream& data) const;
+
+    static void updateSampler(theme_info& theme);
+    static size_t drawWord(theme_info& theme, long long threshold);
+};
+
+#endif
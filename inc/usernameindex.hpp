@@ -0,0 +1,112 @@
+#ifndef USERNAMEINDEX_HPP
+#define USERNAMEINDEX_HPP
+
+#include <algorithm>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/*
+    Tabela de dispersão de endereçamento aberto (sondagem linear) entre o nome ("username") de
+    cada elemento e o próprio elemento (ex. um jogador). Cada posição guarda o valor de
+    dispersão do nome e um ponteiro para o elemento, pelo que os elementos têm de manter o seu
+    endereço e o seu nome enquanto estiverem na tabela. Na "playertable" os elementos são os
+    detalhes de cada jogador, guardados numa std::deque: acrescentar jogadores no fim nunca
+    move os existentes, pelo que os ponteiros (e os "player_handle") continuam válidos.
+
+    A capacidade é sempre uma potência de 2 e a tabela é aumentada para o dobro quando
+    fica mais de metade ocupada.
+*/
+template <typename T>
+class usernameindex {
+private:
+    typedef struct {
+        size_t hash;
+        T* target;
+    } slot;
+
+    std::vector<slot> slots;
+    size_t count = 0;
+
+    static size_t hashUsername(std::string_view username) {
+        return std::hash<std::string_view>()(username);
+    }
+
+    // Obter a posição do elemento com o nome "username", ou a posição livre onde seria inserido.
+    size_t locate(std::string_view username, size_t hash) const {
+        size_t mask = this->slots.size() - 1;
+        size_t position = hash & mask;
+
+        while (this->slots[position].target != nullptr) {
+            const slot& current = this->slots[position];
+            if ((current.hash == hash) && (current.target->username == username)) {
+                break;
+            }
+            position = (position + 1) & mask;
+        }
+        return position;
+    }
+
+    void grow(size_t capacity) {
+        std::vector<slot> previous(capacity, {0, nullptr});
+        previous.swap(this->slots);
+
+        size_t mask = this->slots.size() - 1;
+        for (slot& current : previous) {
+            if (current.target == nullptr) {
+                continue;
+            }
+
+            size_t position = current.hash & mask;
+            while (this->slots[position].target != nullptr) {
+                position = (position + 1) & mask;
+            }
+            this->slots[position] = current;
+        }
+    }
+
+public:
+    T* find(std::string_view username) const {
+        if (this->count == 0) {
+            return nullptr;
+        }
+        return this->slots[locate(username, hashUsername(username))].target;
+    }
+
+    // Acrescentar um elemento à tabela. Um elemento com o mesmo nome é substituído.
+    void insert(T* target) {
+        if ((this->count + 1) * 2 > this->slots.size()) {
+            grow(std::max<size_t>(16, this->slots.size() * 2));
+        }
+
+        size_t hash = hashUsername(target->username);
+        slot& destination = this->slots[locate(target->username, hash)];
+
+        this->count += (destination.target == nullptr);
+        destination.hash = hash;
+        destination.target = target;
+    }
+
+    // Preparar a tabela para "capacity" elementos, evitando aumentos sucessivos.
+    void reserve(size_t capacity) {
+        size_t required = 16;
+        while (required < capacity * 2) {
+            required *= 2;
+        }
+        if (required > this->slots.size()) {
+            grow(required);
+        }
+    }
+
+    void clear() {
+        this->slots.clear();
+        this->count = 0;
+    }
+
+    size_t size() const {
+        return this->count;
+    }
+};
+
+#endif
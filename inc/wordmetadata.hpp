@@ -0,0 +1,25 @@
+#ifndef WORDMETADATA_HPP
+#define WORDMETADATA_HPP
+
+#include <bitset>
+#include <string_view>
+
+#include "stringpool.hpp"
+
+// Conjunto de carateres (um bit por cada valor de um byte).
+typedef std::bitset<256> letter_set;
+
+/*
+    Propriedades de uma palavra que nunca mudam, calculadas uma única vez: as letras que
+    contém, o número de letras diferentes, o tamanho e a forma normalizada (em minúsculas).
+*/
+typedef struct {
+    letter_set letters;
+    int unique;
+    int length;
+    string_id normalized;
+} word_metadata;
+
+word_metadata describeWord(std::string_view word, string_id id = empty_string);
+
+#endif
@@ -0,0 +1,37 @@
+#ifndef WORDSAMPLER_HPP
+#define WORDSAMPLER_HPP
+
+#include <cstddef>
+#include <vector>
+
+// Peso de uma palavra no sorteio: palavras menos escolhidas têm mais peso, e uma palavra
+// com 0 ocorrências nunca é escolhida.
+inline int getWordWeight(int occurences) {
+    return (occurences == 0) ? 0 : 10000 / occurences;
+}
+
+/*
+    Sorteio pesado das palavras de um tema numa árvore de Fenwick com as somas acumuladas
+    dos pesos. Encontrar a palavra correspondente a um valor e atualizar o peso de uma
+    palavra custam O(log n), em vez de percorrer o tema inteiro.
+
+    "find" devolve a primeira palavra cuja soma acumulada (incluindo o seu peso) é superior
+    ao valor, tal como uma pesquisa linear pelas palavras, pelo que a distribuição é a mesma.
+*/
+class wordsampler {
+private:
+    std::vector<long long> tree;
+    long long sum = 0;
+    size_t top_step = 0;
+
+public:
+    void assign(std::vector<long long> weights);
+    void update(size_t index, long long delta);
+
+    size_t find(long long threshold) const;
+    long long total() const;
+    size_t size() const;
+    void clear();
+};
+
+#endif
@@ -0,0 +1,43 @@
+#ifndef WORKPOOL_HPP
+#define WORKPOOL_HPP
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/*
+    Conjunto de threads que executa tarefas numeradas com roubo de trabalho. As tarefas são
+    repartidas em blocos contíguos pelas filas das threads; cada thread executa as suas a
+    partir do fim da fila e, quando a fila fica vazia, rouba tarefas do início das filas das
+    outras threads.
+
+    Cada fila tem o seu próprio mutex, pelo que as threads só competem entre si ao roubar
+    tarefas. A função recebe o número da thread (0 a "size() - 1"), para que cada thread
+    utilize o seu próprio estado sem sincronização.
+*/
+class workpool {
+private:
+    // Cada fila ocupa linhas de cache próprias, para que as threads não se atrasem umas às outras.
+    struct alignas(64) task_queue {
+        std::mutex lock;
+        std::deque<size_t> tasks;
+    };
+
+    std::vector<std::unique_ptr<task_queue>> queues;
+
+    bool next(size_t worker, size_t& task);
+
+public:
+    workpool(size_t workers = 0);
+
+    workpool(const workpool&) = delete;
+    workpool& operator=(const workpool&) = delete;
+
+    size_t size() const;
+    void run(size_t tasks, const std::function<void(size_t worker, size_t task)>& function);
+};
+
+#endif
@@ -0,0 +1,60 @@
+#ifndef WRITER_HPP
+#define WRITER_HPP
+
+#include <iostream>
+#include <string>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include "io.hpp"
+
+/*
+    Escritor de ficheiros em segundo plano. O jogo entrega cópias dos dados a guardar e
+    continua de imediato; a thread do escritor grava-os pela ordem em que foram pedidos.
+
+    Pedidos consecutivos para o mesmo ficheiro são juntos num só: uma substituição substitui a
+    anterior e os acréscimos são concatenados. A fila tem uma capacidade limitada, a partir da
+    qual quem pede uma escrita espera que o escritor avance.
+*/
+class writer {
+private:
+    enum job_kind {
+        JOB_REPLACE,
+        JOB_APPEND
+    };
+
+    typedef struct {
+        int kind;
+        std::string filename;
+        std::string data;
+    } job;
+
+    std::deque<job> jobs;
+    bool busy;
+    bool stopping;
+
+    std::mutex lock;
+    std::condition_variable work_available;
+    std::condition_variable work_done;
+    std::thread worker;
+
+    void submit(int kind, std::string filename, std::string data);
+    void run();
+
+public:
+    static const size_t capacity = 64;
+
+    writer();
+    ~writer();
+
+    writer(const writer&) = delete;
+    writer& operator=(const writer&) = delete;
+
+    void replace(std::string filename, std::string data);
+    void append(std::string filename, std::string data);
+    void flush();
+};
+
+#endif
@@ -0,0 +1,111 @@
+#include "atlas.hpp"
+
+#include <algorithm>
+
+atlas::atlas() {
+    this->data = nullptr;
+    this->size = 0;
+    this->count = 0;
+}
+
+atlas::~atlas() {
+    release();
+}
+
+void atlas::release() {
+    this->file.close();
+    this->data = nullptr;
+    this->size = 0;
+    this->count = 0;
+}
+
+/*
+    Confirmar que o conteúdo carregado respeita a geometria de 32 linhas por 73 bytes
+    (72 carateres e a quebra de linha). A última imagem pode não ter a quebra de linha final.
+*/
+bool atlas::validate(std::string filename) {
+    if ((this->size + 1) % image_size == 0) {
+        this->count = (this->size + 1) / image_size;
+    } else if (this->size % image_size == 0) {
+        this->count = this->size / image_size;
+    } else {
+        this->count = 0;
+    }
+
+    if (this->count == 0) {
+        std::cout << "Erro: O ficheiro \'" << filename << "\' nao contem imagens de "
+            << image_height << "x" << image_width << " bytes\n";
+        return false;
+    }
+
+    for (size_t i = image_width - 1; i < this->size; i += image_width) {
+        if (this->data[i] != '\n') {
+            std::cout << "Erro: O ficheiro \'" << filename << "\' tem uma linha com tamanho invalido (linha "
+                << (i / image_width) + 1 << ")\n";
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*
+    Mapear o ficheiro de imagens em memória e validar a sua geometria.
+    Devolve falso caso o ficheiro não exista ou não seja uma tabela de imagens válida.
+*/
+bool atlas::load(std::string filename) {
+    release();
+
+    if (!this->file.open(filename)) {
+        std::cout << "Erro: " << this->file.error() << "\n";
+        return false;
+    }
+
+    this->data = this->file.view().data();
+    this->size = this->file.view().size();
+
+    if (!validate(filename)) {
+        release();
+        return false;
+    }
+
+    return true;
+}
+
+/*
+    Utilizar uma tabela de imagens já presente em memória (ex. embutida no executável).
+    O conteúdo não é copiado e tem de existir enquanto o atlas for utilizado.
+*/
+bool atlas::load(std::string_view buffer, std::string name) {
+    release();
+
+    this->data = buffer.data();
+    this->size = buffer.size();
+
+    if (!validate(name)) {
+        release();
+        return false;
+    }
+
+    return true;
+}
+
+/*
+    Sabendo que o tamanho de cada "imagem" de texto é um bloco de 32 * 73 bytes,
+    sendo estas imagens contíguas na memória, é possível tratar o ficheiro como uma
+    tabela de imagens, associando um índice numérico a cada uma.
+    Um índice fora da tabela devolve uma imagem vazia.
+*/
+std::string_view atlas::getImage(int index) const {
+    if ((index < 0) || (index >= this->count)) {
+        return std::string_view();
+    }
+
+    size_t offset = (size_t)index * image_size;
+    size_t length = std::min((size_t)image_size, this->size - offset);
+    return std::string_view(this->data + offset, length);
+}
+
+int atlas::getImageCount() const {
+    return this->count;
+}
@@ -1,161 +1,454 @@
 #include "game.hpp"
+#include "embedded.hpp"
+
+// Número de alterações pendentes, ou segundos desde a última gravação, que obrigam a guardar os temas.
+static const int theme_flush_changes = 32;
+static const float theme_flush_interval = 60;
 
 /*
     Construtor da classe do jogo, responsável por inicializar todos os elementos necessários para a
     sua execução.
 */
-game::game() {
+game::game(game_options __options) {
     this->running = true;
     this->state = GAME_STATE_RESET;
-    this->images = getFileData("images.txt").str();
+    this->options = __options;
+
+    this->input = this->options.input;
+    if (this->input == nullptr) {
+        this->terminal_source = std::make_unique<terminal_input>(this->options.record_filename);
+        this->input = this->terminal_source.get();
+    }
+    this->terminal.setOutputEnabled(!this->options.null_output);
+    loadImageData();
     this->active_username = "none";
+    this->active_handle = invalid_player;
+    this->leaderboard_ready = false;
     this->start_of_page = 0;
+    this->journal_entries = 0;
+    this->theme_changes = 0;
+    this->theme_flush_time = std::chrono::steady_clock::now();
+    this->hint_theme = empty_string;
 
-    srand(time(NULL));
+    this->generator.seed(this->options.has_seed ? this->options.seed : time(NULL));
 
     loadPlayerData();
     loadThemeData();
 }
 
+/*
+    Ao terminar, o diário dos jogadores é compactado no ficheiro "players.txt" e as
+    alterações pendentes dos temas são guardadas, esperando que o escritor as grave.
+    Um erro ao gravar em "players.bin" durante o jogo só é apresentado aqui.
+*/
 game::~game() {
+    if (this->options.binary_store || (this->journal_entries > 0)) {
+        savePlayerData();
+    }
+    flushThemeData(true);
+    this->persistence.flush();
 
+    if (this->store_error != "") {
+        std::cout << "Erro: " << this->store_error << "\n";
+    }
 }
 
 /*
     Metodo para receber o input do utilizador. Esta função bloqueia a execução do programa.
+    Quando o input termina, o jogo deixa de estar em execução e é devolvido um texto vazio.
 */
 std::string game::getUserInput() {
     std::string input;
-    std::cin >> input;
+    if (!this->input->next(input)) {
+        this->running = false;
+        input = "";
+    }
+
+    // O terminal ecoou o texto introduzido, pelo que o conteúdo abaixo do cursor deixou de ser conhecido.
+    this->terminal.invalidate();
     return input;
 }
 
 /*
-    Sabendo que o tamanho de cada "imagem" de texto é um bloco de 32 * 73 bytes,
-    sendo estas imagens contíguos na memória, é possível tratar "images" como uma
-    tabela de imagens, associando um índice numérico a cada uma.
+    Obter uma vista sobre a imagem de índice "index" da tabela de imagens.
+    A vista é válida enquanto o jogo existir.
 */
-std::string game::getImageAtIndex(int index) {
-    int size = 32 * 73;
-    return this->images.substr(index * size, size);
+std::string_view game::getImageAtIndex(int index) {
+    return this->images.getImage(index);
 }
 
 /*
-    Definir qual a posição do cursor do terminal, relativamente ao canto superior esquerdo.
-    
-    Implementado com base no seguinte tópico:
-    https://stackoverflow.com/questions/54250401/how-to-control-a-cursor-position-in-c-console-application
+    Escrever texto na imagem em composição, na posição (x, y) relativa ao canto superior
+    esquerdo. Nada é enviado para o terminal até à chamada de "commit".
 */
-inline void game::setCursorPos(int x, int y) {
-#if defined(_WIN32)
-    SetConsoleCursorPosition(
-        GetStdHandle(STD_OUTPUT_HANDLE), 
-        {(short int) (x - 1), (short int) (y - 1)}
-    );
-#elif defined(__LINUX__) || defined(__gnu_linux__) || defined(__linux__)
-    printf("%c[%d;%df", 0x1B, y, x);
-#endif
+void game::stamp(int x, int y, std::string_view text) {
+    this->terminal.stamp(x, y, text);
+}
+
+/*
+    Enviar a imagem composta para o terminal numa única escrita, deixando o cursor na
+    posição (x, y), normalmente onde é pedido o input do utilizador.
+*/
+void game::commit(int x, int y) {
+    this->terminal.commit(x, y);
 }
 
 /*
     Função apenas para fins estéticos. Utilizado para designar uma seleção do utilizador
     e bloquear a execução do programa durante um determinado periodo de tempo.
+    Com "selection_delay" a 0 a animação é ignorada por completo.
+*/
+inline void game::setSelectionDelay(int x, int y) {
+    if (this->options.selection_delay <= 0) {
+        return;
+    }
+
+    stamp(x, y, "> ");
+    commit(x + 2, y);
+    std::this_thread::sleep_for(std::chrono::milliseconds(this->options.selection_delay));
+}
+
+/*
+    Carregar a tabela de imagens embutida no executável, ou a indicada nas opções, caso exista.
 */
-inline void game::setSelectionDelay(int x, int y, int delay) {
-    setCursorPos(x, y);
-    render("> ", false);
-    std::this_thread::sleep_for(std::chrono::milliseconds(delay));
+void game::loadImageData() {
+    static_assert(
+        (embedded_image_width == atlas::image_width) && (embedded_image_height == atlas::image_height),
+        "A geometria das imagens embutidas difere da do atlas"
+    );
+
+    bool loaded = false;
+    if (this->options.images_filename != "") {
+        loaded = this->images.load(this->options.images_filename);
+    } else {
+        loaded = this->images.load(std::string_view(embedded_images, sizeof(embedded_images) - 1), "embedded");
+    }
+
+    if (!loaded) {
+        exit(-1);
+    }
 }
 
 /*
-    Guardar os dados de todos os jogadores carregados na lista dinâmica "players" no ficheiro "players.txt".
+    Guardar os dados de todos os jogadores carregados na tabela "players" no ficheiro "players.txt".
+    Como o ficheiro passa a conter todas as alterações, o diário é esvaziado (compactação).
+
+    No ficheiro binário cada registo é atualizado individualmente, pelo que basta guardar os
+    jogadores novos e o jogador ativo, os únicos alterados durante a sessão.
 */
 void game::savePlayerData() {
-    std::stringstream data;
+    syncActivePlayer();
+
+    if (this->options.binary_store) {
+        player temp;
+        for (player_handle handle = 0; handle < this->players.size(); handle++) {
+            if (handle == this->active_handle) {
+                writePlayerRecord(this->active, handle);
+            } else if (this->players.getStoreIndex(handle) < 0) {
+                this->players.get(handle, temp);
+                writePlayerRecord(temp, handle);
+            }
+        }
+        return;
+    }
 
+    // Os jogadores que ainda não foram carregados são copiados diretamente do ficheiro atual.
+    // Se algum não puder ser lido, a compactação é abandonada e o ficheiro e o diário atuais
+    // mantêm-se, para que nenhum jogador seja perdido.
+    std::stringstream records;
     int playerCount = this->players.size();
+    bool copied = this->index.readUnloaded([&](std::string_view raw) {
+        records << raw << "\n";
+        playerCount++;
+    });
+
+    if (!copied) {
+        return;
+    }
 
-    data << playerCount << "\n";
-    for (player& temp : this->players) {
-        temp.toRawPlayerData(data);
+    player temp;
+    for (player_handle handle = 0; handle < this->players.size(); handle++) {
+        this->players.get(handle, temp);
+        temp.toRawPlayerData(records);
     }
 
-    setFileData("players.txt", data);
+    std::stringstream data;
+    data << playerCount << "\n" << records.str();
+
+    std::string snapshot = data.str();
+    this->persistence.replace("players.txt", snapshot);
+
+    if (this->journal_entries > 0) {
+        this->persistence.replace("players.journal", "");
+        this->journal_entries = 0;
+    }
+
+    // O índice passa a referir o novo ficheiro, pelo que este tem de estar escrito primeiro.
+    if (this->options.lazy_loading) {
+        this->persistence.flush();
+        this->index.assign(snapshot);
+        for (player_handle handle = 0; handle < this->players.size(); handle++) {
+            markPlayerLoaded(this->players.getUsername(handle));
+        }
+        this->index.save();
+    }
 }
 
 /*
-    Carregar os dados de todos os jogadores guardados no ficheiro "players.txt" na lista dinâmica "players".
+    Guardar o estado atual de um jogador sem reescrever os restantes: no ficheiro binário o seu
+    registo é reescrito, caso contrário é acrescentada uma entrada ao diário "players.journal".
+    Cada entrada ocupa uma linha com os mesmos campos de "players.txt".
+    Quando o diário cresce mais do que o número de jogadores, é compactado.
+*/
+void game::updatePlayerData(player& __player) {
+    player_handle handle = this->players.add(__player);
+    updateRanking(handle);
+
+    if (this->options.binary_store) {
+        writePlayerRecord(__player, handle);
+        return;
+    }
+
+    std::stringstream data;
+    __player.toRawPlayerData(data);
+
+    std::string entry = data.str();
+    std::replace(entry.begin(), entry.end(), '\n', ' ');
+    entry.back() = '\n';
+
+    this->persistence.append("players.journal", std::move(entry));
+    this->journal_entries++;
+
+    if (this->journal_entries > std::max<size_t>(1024, this->players.size() + this->index.size())) {
+        savePlayerData();
+    }
+}
+
+void game::writePlayerRecord(player& __player, player_handle handle) {
+    if (!this->store.write(__player)) {
+        this->store_error = this->store.error();
+    }
+    this->players.setStoreIndex(handle, __player.store_index);
+}
+
+/*
+    Carregar os dados de todos os jogadores guardados no ficheiro "players.txt" na lista dinâmica "players",
+    aplicando depois as entradas do diário. Uma última entrada incompleta (ex. interrompida a meio
+    da escrita) é ignorada.
+
+    Com o ficheiro binário ("players.bin") os registos são mapeados diretamente em memória.
+    Com "lazy_loading" apenas é construído o índice dos registos, e cada jogador é carregado
+    quando for necessário.
 */
 void game::loadPlayerData() {
-    std::stringstream data = getFileData("players.txt");
-    int playerCount = 0;
+    if (this->options.binary_store) {
+        if (!this->store.open("players.bin") || !this->store.load(this->players)) {
+            std::cout << "Erro: " << this->store.error() << "\n";
+            exit(-1);
+        }
+        this->leaderboard_ready = false;
+        return;
+    }
 
-    data >> playerCount;
-    for (int i = 0; i < playerCount; i++) {
-        player loaded;
-        loaded.fromRawPlayerData(data);
-        this->players.push_back(loaded);
+    if (this->options.lazy_loading) {
+        if (!this->index.build("players.txt", "players.idx")) {
+            exit(-1);
+        }
+    } else if (hasFileData("players.txt")) {
+        mappedfile file;
+        if (!file.open("players.txt")) {
+            std::cout << "Erro: " << file.error() << "\n";
+            exit(-1);
+        }
+
+        textparser data(file.view(), "players.txt");
+        int playerCount = 0;
+
+        bool valid = data.nextInt(playerCount, "numero de jogadores");
+        for (int i = 0; valid && (i < playerCount); i++) {
+            player loaded;
+            valid = loaded.parseRawPlayerData(data);
+            this->players.add(loaded);
+        }
+
+        if (!valid) {
+            std::cout << "Erro: " << data.error() << "\n";
+            exit(-1);
+        }
+    }
+    this->leaderboard_ready = false;
+
+    this->journal_entries = 0;
+    std::string error;
+    bool read = readPlayerJournal("players.journal", [&](const player& loaded) {
+        addPlayer(loaded);
+        this->journal_entries++;
+    }, error);
+
+    if (!read) {
+        std::cout << "Erro: " << error << "\n";
+        exit(-1);
     }
 }
 
 /*
     Determinar se existe registo de algum jogador com um determinado identificador "__username".
-    Caso for encontrado, é devolvido uma referência ao objeto do jogador, senão é
-    criado um novo registo com o mesmo identificador e devolvido a sua referência.
+    Caso for encontrado, é devolvido o identificador do jogador na tabela, senão é
+    criado um novo registo com o mesmo nome e devolvido o seu identificador.
 */
-player& game::getPlayerFromUsername(std::string __username) {
-    for (player& temp : this->players) {
-        if (temp.username == __username) {
-            return temp;
+player_handle game::getPlayerFromUsername(std::string __username) {
+    player_handle found = this->players.find(__username);
+    if (found != invalid_player) {
+        return found;
+    }
+
+    player_entry* entry = this->index.find(__username);
+    if ((entry != nullptr) && !entry->loaded) {
+        player loaded;
+        if (this->index.read(*entry, loaded)) {
+            return addPlayer(loaded);
         }
+        std::cout << "Erro: Nao foi possivel carregar o jogador \'" << __username << "\'\n";
     }
 
-    this->players.push_back(player(__username));
-    return this->players.back();
+    return addPlayer(player(__username));
 }
 
+/*
+    Obter o jogador com sessão iniciada. Os atores alteram esta cópia, que é guardada na
+    tabela de jogadores em "updatePlayerData" ou "syncActivePlayer".
+*/
+player& game::getActivePlayer() {
+    return this->active;
+}
+
+void game::syncActivePlayer() {
+    if (this->active_handle != invalid_player) {
+        this->players.set(this->active_handle, this->active);
+    }
+}
+
+/*
+    Acrescentar (ou substituir) um jogador na tabela "players", mantendo a tabela de
+    pontuações e o índice de "players.txt" atualizados.
+*/
+player_handle game::addPlayer(const player& __player) {
+    player_handle handle = this->players.add(__player);
+    markPlayerLoaded(__player.username);
+    updateRanking(handle);
+    return handle;
+}
+
+/*
+    Obter a tabela de pontuações, construindo-a na primeira consulta a partir de todos os
+    jogadores carregados e dos jogadores do índice que ainda não foram carregados.
+    Depois de construída, é atualizada a cada alteração de um jogador.
+*/
+ranking& game::getLeaderboard() {
+    if (this->leaderboard_ready) {
+        return this->leaderboard;
+    }
+
+    syncActivePlayer();
+
+    std::vector<leaderboard_entry> ranked;
+    ranked.reserve(this->players.size() + this->index.size());
+
+    for (player_entry& entry : this->index.getEntries()) {
+        if (!entry.loaded) {
+            ranked.push_back({entry.username, entry.score});
+        }
+    }
+    for (player_handle handle = 0; handle < this->players.size(); handle++) {
+        ranked.push_back({this->players.getUsername(handle), this->players.getScore(handle)});
+    }
+
+    this->leaderboard.assign(std::move(ranked));
+    this->leaderboard_ready = true;
+    return this->leaderboard;
+}
+
+void game::updateRanking(player_handle handle) {
+    if (this->leaderboard_ready) {
+        this->leaderboard.update(this->players.getUsername(handle), this->players.getScore(handle));
+    }
+}
 
 /*
-    Guardar os dados de todos os temas carregados na lista dinâmica "themes" no ficheiro "themes.txt".
+    Marcar no índice que os dados de um jogador passaram a estar em memória.
+*/
+void game::markPlayerLoaded(const std::string& __username) {
+    player_entry* entry = this->index.find(__username);
+    if (entry != nullptr) {
+        entry->loaded = true;
+    }
+}
+
+
+/*
+    Guardar os dados de todos os temas do catálogo "themes" no ficheiro "themes.txt".
 */
 void game::saveThemeData() {
     std::stringstream data;
+    this->themes.write(data);
 
-    int themeCount = this->themes.size();
+    this->persistence.replace("themes.txt", data.str());
 
-    data << themeCount << "\n";
-    for (std::list<word_info>& theme : this->themes) {
-        int wordCount = theme.size();
-        data << wordCount << "\n";
-        for (word_info& word : theme) {
-            data << word.word << " " << word.occurences << "\n";
-        }
+    this->theme_changes = 0;
+    this->theme_flush_time = std::chrono::steady_clock::now();
+}
+
+/*
+    Guardar os temas apenas se existirem alterações pendentes (ex. contagem de ocorrências das
+    palavras) e se já se acumularam alterações suficientes, ou passou tempo suficiente desde a
+    última gravação. Com "force" as alterações pendentes são sempre guardadas.
+*/
+void game::flushThemeData(bool force) {
+    if (this->theme_changes == 0) {
+        return;
     }
 
-    setFileData("themes.txt", data);
+    std::chrono::duration<float> elapsed = std::chrono::steady_clock::now() - this->theme_flush_time;
+
+    if (force || (this->theme_changes >= theme_flush_changes) || (elapsed.count() >= theme_flush_interval)) {
+        saveThemeData();
+    }
 }
 
 /*
     Carregar todos os temas, e as suas palavras associados do ficheiro "themes.txt".
+    Caso o ficheiro não exista, são utilizados os temas por omissão embutidos no executável.
 */
 void game::loadThemeData() {
-    std::stringstream data = getFileData("themes.txt");
-    int themeCount = 0;
-
-    data >> themeCount;
-    for (int i = 0; i < themeCount; i++) {
-        std::list<word_info> loadedTheme;
-        int wordCount = 0;
-
-        data >> wordCount;
-        for (int j = 0; j < (wordCount); j++) {
-            word_info loadedWord;
-            data >> loadedWord.word >> loadedWord.occurences;
-            loadedTheme.push_back(loadedWord);
+    std::string error;
+    if (!loadThemeCatalog(this->themes, error)) {
+        std::cout << "Erro: " << error << "\n";
+        exit(-1);
+    }
+}
+
+/*
+    Carregar o catálogo dos temas de "themes.txt", ou dos temas embutidos no executável se o
+    ficheiro não existir, sem criar um jogo (ex. simulação de rondas).
+*/
+bool loadThemeCatalog(themecatalog& themes, std::string& error) {
+    mappedfile file;
+    std::string_view source = embedded_themes;
+
+    if (hasFileData("themes.txt")) {
+        if (!file.open("themes.txt")) {
+            error = file.error();
+            return false;
         }
+        source = file.view();
+    }
 
-        this->themes.push_back(loadedTheme);
+    textparser data(source, "themes.txt");
+    if (!themes.parse(data)) {
+        error = data.error();
+        return false;
     }
+    return true;
 }
 
 
@@ -171,13 +464,15 @@ void game::loadThemeData() {
 */
 int game::loginActor() {
     render(getImageAtIndex(0));
-    setCursorPos(15, 31);
+    commit(15, 31);
 
     std::string username = getUserInput();
 
-    if ((username.size() > 3) && (username.size() < 15)) {
+    if ((username.size() > 3) && (username.size() <= max_username_length)) {
+        syncActivePlayer();
         this->active_username = username;
-        getPlayerFromUsername(this->active_username);
+        this->active_handle = getPlayerFromUsername(this->active_username);
+        this->players.get(this->active_handle, this->active);
 
         return GAME_STATE_MENU;
     }
@@ -199,7 +494,7 @@ int game::loginActor() {
 */
 int game::logoutActor() {
     render(getImageAtIndex(2));
-    setCursorPos(10, 31);
+    commit(10, 31);
 
     std::string selection = getUserInput();
 
@@ -210,11 +505,13 @@ int game::logoutActor() {
     switch(selection[0]) {
     case '1':
         savePlayerData();
-        setSelectionDelay(23, 24, 800);
+        flushThemeData(true);
+        this->persistence.flush();
+        setSelectionDelay(23, 24);
         return GAME_STATE_LOGIN;
 
     case '2':
-        setSelectionDelay(40, 24, 800);
+        setSelectionDelay(40, 24);
         return GAME_STATE_MENU;
     }
 
@@ -241,12 +538,11 @@ int game::logoutActor() {
 int game::menuActor() {
    render(getImageAtIndex(1));
 
-    if(getPlayerFromUsername(this->active_username).gamemode_persistent < GAMEMODE_ADVANCED) {
-        setCursorPos(23, 22);
-        render("                         ", false);
+    if(getActivePlayer().gamemode_persistent < GAMEMODE_ADVANCED) {
+        stamp(23, 22, "                         ");
     }
 
-    setCursorPos(10, 31);
+    commit(10, 31);
 
     std::string selection = getUserInput();
 
@@ -256,23 +552,23 @@ int game::menuActor() {
 
     switch(selection[0]) {
     case '1':
-        setSelectionDelay(23, 16, 800);
+        setSelectionDelay(23, 16);
         return GAME_STATE_NEW_GAME;
     case '2':
-        setSelectionDelay(23, 18, 800);
+        setSelectionDelay(23, 18);
         return GAME_STATE_GAMEMODE;
     case '3':
-        setSelectionDelay(23, 20, 800);
+        setSelectionDelay(23, 20);
         return GAME_STATE_LEADERBOARD;
     case '4':
-        if(getPlayerFromUsername(this->active_username).gamemode_persistent < GAMEMODE_ADVANCED) {
+        if(getActivePlayer().gamemode_persistent < GAMEMODE_ADVANCED) {
             return GAME_STATE_MENU;
         } else {
-            setSelectionDelay(23, 22, 800);
+            setSelectionDelay(23, 22);
             return GAME_STATE_CONFIG;
         }
     case '5':
-        setSelectionDelay(23, 24, 800);
+        setSelectionDelay(23, 24);
         return GAME_STATE_LOGOUT;
     }
 
@@ -299,7 +595,7 @@ int game::menuActor() {
 */
 int game::gamemodeActor() {
     render(getImageAtIndex(3));
-    setCursorPos(10, 31);
+    commit(10, 31);
 
     std::string selection = getUserInput();
 
@@ -309,27 +605,27 @@ int game::gamemodeActor() {
 
     switch(selection[0]) {
     case '1':
-        getPlayerFromUsername(this->active_username).gamemode_persistent = GAMEMODE_SIMPLE;
-        setSelectionDelay(23, 14, 800);
+        getActivePlayer().gamemode_persistent = GAMEMODE_SIMPLE;
+        setSelectionDelay(23, 14);
         return GAME_STATE_GAMEMODE;
     case '2':
-        getPlayerFromUsername(this->active_username).gamemode_persistent = GAMEMODE_BASIC;
-        setSelectionDelay(23, 16, 800);
+        getActivePlayer().gamemode_persistent = GAMEMODE_BASIC;
+        setSelectionDelay(23, 16);
         return GAME_STATE_DIFFICULTY;
     case '3':
-        getPlayerFromUsername(this->active_username).gamemode_persistent = GAMEMODE_MEDIUM;
-        setSelectionDelay(23, 18, 800);
+        getActivePlayer().gamemode_persistent = GAMEMODE_MEDIUM;
+        setSelectionDelay(23, 18);
         return GAME_STATE_DIFFICULTY;
     case '4':
-        getPlayerFromUsername(this->active_username).gamemode_persistent = GAMEMODE_ADVANCED;
-        setSelectionDelay(23, 20, 800);
+        getActivePlayer().gamemode_persistent = GAMEMODE_ADVANCED;
+        setSelectionDelay(23, 20);
         return GAME_STATE_DIFFICULTY;
     case '5':
-        getPlayerFromUsername(this->active_username).gamemode_persistent = GAMEMODE_PROFESSIONAL;
-        setSelectionDelay(23, 22, 800);
+        getActivePlayer().gamemode_persistent = GAMEMODE_PROFESSIONAL;
+        setSelectionDelay(23, 22);
         return GAME_STATE_DIFFICULTY;
     case '6':
-        setSelectionDelay(23, 24, 800);
+        setSelectionDelay(23, 24);
         return GAME_STATE_MENU;
     }
 
@@ -357,7 +653,7 @@ int game::gamemodeActor() {
 */
 int game::difficultyActor() {
     render(getImageAtIndex(4));
-    setCursorPos(10, 31);
+    commit(10, 31);
 
     std::string selection = getUserInput();
 
@@ -367,19 +663,19 @@ int game::difficultyActor() {
 
     switch(selection[0]) {
     case '1':
-        getPlayerFromUsername(this->active_username).difficulty_persistent = DIFFICULTY_EASY;
-        setSelectionDelay(23, 18, 800);
+        getActivePlayer().difficulty_persistent = DIFFICULTY_EASY;
+        setSelectionDelay(23, 18);
         return GAME_STATE_GAMEMODE;
     case '2':
-        getPlayerFromUsername(this->active_username).difficulty_persistent = DIFFICULTY_MEDIUM;
-        setSelectionDelay(23, 20, 800);
+        getActivePlayer().difficulty_persistent = DIFFICULTY_MEDIUM;
+        setSelectionDelay(23, 20);
         return GAME_STATE_GAMEMODE;
     case '3':
-        getPlayerFromUsername(this->active_username).difficulty_persistent = DIFFICULTY_HARD;
-        setSelectionDelay(23, 22, 800);
+        getActivePlayer().difficulty_persistent = DIFFICULTY_HARD;
+        setSelectionDelay(23, 22);
         return GAME_STATE_GAMEMODE;
     case '4':
-        setSelectionDelay(23, 24, 800);
+        setSelectionDelay(23, 24);
         return GAME_STATE_MENU;
     }
 
@@ -400,46 +696,27 @@ int game::difficultyActor() {
 int game::leaderboardActor() {
     render(getImageAtIndex(6));
 
-    this->players.sort([](const player& p1, const player& p2) {
-        return p1.score_persistent > p2.score_persistent;
-    });
-
     // Mostrar estatísticas do jogador
-    player& activePlayer = getPlayerFromUsername(this->active_username);
-
-    setCursorPos(7, 6);
-    render(activePlayer.username, false);
-    setCursorPos(18, 8);
-    render(std::to_string(activePlayer.score_persistent) + " Pts.", false);
-    setCursorPos(18, 10);
-    render(std::to_string(activePlayer.rounds_persistent), false);
-    setCursorPos(18, 12);
-    render(std::to_string(activePlayer.fails_persistent), false);
-    setCursorPos(18, 14);
-    render(std::to_string((int)(activePlayer.time_persistent / 60)) + " Min.", false);
-
-    int num_player = 0;
-    int placement = this->start_of_page;
-    for (player& temp : this->players) {
-        if (num_player < this->start_of_page) {
-            num_player++;
-            continue;
-        } else if (placement >= this->start_of_page + 7) {
-            break;
-        }
-
-        setCursorPos(40, 5 + (placement - this->start_of_page) * 3);
-        render(std::to_string(placement), false);
-        setCursorPos(44, 5 + (placement - this->start_of_page) * 3);
-        render(temp.username, false);
-        setCursorPos(44, 6 + (placement - this->start_of_page) * 3);
-        render(std::to_string(temp.score_persistent) + " Pts.", false);
-        
-        placement++;
-        num_player++;
+    player& activePlayer = getActivePlayer();
+
+    stamp(7, 6, activePlayer.username);
+    stamp(18, 8, std::to_string(activePlayer.score_persistent) + " Pts.");
+    stamp(18, 10, std::to_string(activePlayer.rounds_persistent));
+    stamp(18, 12, std::to_string(activePlayer.fails_persistent));
+    stamp(18, 14, std::to_string((int)(activePlayer.time_persistent / 60)) + " Min.");
+
+    ranking& leaderboard = getLeaderboard();
+    long position = leaderboard.rank(activePlayer.username);
+    stamp(9, 16, "Posicao: " + std::to_string(position));
+
+    std::vector<leaderboard_entry> page = leaderboard.page(this->start_of_page, 7);
+    for (int i = 0; i < (int)page.size(); i++) {
+        stamp(40, 5 + i * 3, std::to_string(this->start_of_page + i));
+        stamp(44, 5 + i * 3, page[i].username);
+        stamp(44, 6 + i * 3, std::to_string(page[i].score) + " Pts.");
     }
 
-    setCursorPos(10, 31);
+    commit(10, 31);
 
     std::string selection = getUserInput();
 
@@ -449,21 +726,20 @@ int game::leaderboardActor() {
 
     switch(selection[0]) {
     case '1':
-        setSelectionDelay(6, 26, 800);
+        setSelectionDelay(6, 26);
         this->start_of_page = 0;
         return GAME_STATE_MENU;
     case '2':
-        setSelectionDelay(26, 26, 800);
+        setSelectionDelay(26, 26);
         this->start_of_page -= 7;
         if (this->start_of_page < 0) {
             this->start_of_page = 0;
         }
         return GAME_STATE_LEADERBOARD;
     case '3':
-        setSelectionDelay(47, 26, 800);
-        this->start_of_page += 7;
-        if (this->start_of_page < 0) {
-            this->start_of_page = 0;
+        setSelectionDelay(47, 26);
+        if (this->start_of_page + 7 < (int)getLeaderboard().size()) {
+            this->start_of_page += 7;
         }
         return GAME_STATE_LEADERBOARD;
     }
@@ -504,7 +780,7 @@ inline void resetPlayerRuntimeData(player& activePlayer) {
 */
 
 int game::newGameActor() {
-    player& activePlayer = getPlayerFromUsername(this->active_username);
+    player& activePlayer = getActivePlayer();
 
     if (activePlayer.score_runtime == 0) {
         resetPlayerRuntimeData(activePlayer);
@@ -512,7 +788,7 @@ int game::newGameActor() {
     }
     
     render(getImageAtIndex(5));
-    setCursorPos(10, 31);
+    commit(10, 31);
 
     std::string selection = getUserInput();
 
@@ -522,13 +798,13 @@ int game::newGameActor() {
 
     switch(selection[0]) {
     case '1':
-        setSelectionDelay(20, 24, 800);
+        setSelectionDelay(20, 24);
         return GAME_STATE_ROUND;
     case '2':
-        setSelectionDelay(37, 24, 800);
+        setSelectionDelay(37, 24);
 
         resetPlayerRuntimeData(activePlayer);
-        savePlayerData();
+        updatePlayerData(activePlayer);
 
         return GAME_STATE_THEME;  
     }
@@ -539,43 +815,36 @@ int game::newGameActor() {
 /*
     Implementado com base na seguinte questão:
     https://stackoverflow.com/questions/1761626/weighted-random-numbers
+
+    As somas acumuladas dos pesos estão na árvore de Fenwick do tema, pelo que escolher a
+    palavra e atualizar o seu peso custa O(log n). O valor é sorteado sem enviesamento entre 0
+    e o total (incluído, que repõe as ocorrências), em 64 bits para temas muito grandes.
 */
-std::string game::selectRandomWord(std::string theme) {
-    std::list<word_info>& theme_data = getThemeFromName(theme);
+string_id game::selectRandomWord(string_id theme) {
+    theme_info& theme_data = getThemeFromName(theme);
 
-    int weighted_sum = 0;
-    for(word_info& word : theme_data) {
-        if (word.occurences == 0) {
-            continue;
-        }
-        int weight = 10000 / word.occurences;
-        weighted_sum += weight;
+    // Tema sem palavras: a palavra escolhida é o próprio nome do tema.
+    if (theme_data.words.empty()) {
+        return theme_data.name;
     }
 
-    int threshold = randi(0, weighted_sum);
+    long long threshold = this->generator.bounded(theme_data.sampler.total() + 1);
+    size_t index = themecatalog::drawWord(theme_data, threshold);
 
-    for(word_info& word : theme_data) {
-        if (word.occurences == 0) {
-            continue;
-        }
-        int weight = 10000 / word.occurences;
-        if (threshold < weight) {
-            word.occurences++;
-            saveThemeData();
-            return word.word;
-        }
-        threshold -= weight;
-    }
+    this->theme_changes++;
+    return theme_data.words[index].word;
+}
 
-    for(word_info& word : theme_data) {
-        if (word.occurences == 0) {
-            continue;
-        }
-        word.occurences = 1;
+/*
+    Sugerir a próxima letra da ronda, a partir das palavras do tema. O índice das palavras
+    só é reconstruído quando o tema muda ou as suas palavras são alteradas.
+*/
+char game::getHint(string_id theme, const roundstate& round) {
+    if (this->hint_theme != theme) {
+        this->hint_solver.build(getThemeFromName(theme));
+        this->hint_theme = theme;
     }
-
-    saveThemeData();
-    return theme_data.back().word;
+    return this->hint_solver.suggest(round.getPattern(), round.getCorrectLetters(), round.getMissingLetters());
 }
 
 /*
@@ -590,17 +859,12 @@ std::string game::selectRandomWord(std::string theme) {
     else return GAME_STATE_THEME
 */
 int game::themeActor() {
-    player& activePlayer = getPlayerFromUsername(this->active_username);
+    player& activePlayer = getActivePlayer();
 
     if (activePlayer.gamemode_persistent == GAMEMODE_SIMPLE) {
-        int select = randi(0, this->themes.size());
-        int count = 0;
-        for (std::list<word_info>& theme : this->themes) {
-            if (select == count) {
-                activePlayer.theme_persistent = theme.front().word;
-                break;
-            }
-            count++;
+        if (this->themes.size() > 0) {
+            size_t select = randi(this->generator, 0, this->themes.size() - 1);
+            activePlayer.theme_persistent = this->themes[select].name;
         }
         return GAME_STATE_ROUND;
     }
@@ -608,51 +872,34 @@ int game::themeActor() {
     int theme_scroll = 0;
     do {
         render(getImageAtIndex(7));
-        setCursorPos(10, 31);
-        
-        int offset = 0;
-        auto theme_iter = this->themes.begin();
-        while ((offset < theme_scroll) && (theme_iter != this->themes.end())) {
-            offset++;
-            theme_iter++;
-        }
 
         for (int position = 0; position < 8; position++) {
-            if (theme_iter != this->themes.end()) {
-                word_info& word = (*theme_iter).front();
-                setCursorPos(45, 4 + position * 3);
-                render(word.word, false);
-                theme_iter++;
-            }                
+            size_t index = position + theme_scroll;
+            if (index < this->themes.size()) {
+                stamp(45, 4 + position * 3, getString(this->themes[index].name));
+            }
 
             if ((position + theme_scroll) < 0) {
                 continue;
             }
 
-            setCursorPos(40, 4 + position * 3);
-            render(std::to_string(position + theme_scroll), false);
+            stamp(40, 4 + position * 3, std::to_string(position + theme_scroll));
         }
 
-        setCursorPos(10, 31);
+        commit(10, 31);
         std::string selection = getUserInput();
 
         if (selection.size() > 1) {
-            bool exists = false;
-            for (std::list<word_info>& theme : this->themes) {
-                if (theme.front().word == selection) {
-                    exists = true;
-                    break;
-                }
-            }
-
-            if (exists) {
-                activePlayer.theme_persistent = selection;
+            // O texto introduzido só é procurado no conjunto, para não guardar textos inválidos.
+            string_id selected = empty_string;
+            if (stringpool::global().find(selection, selected) && (this->themes.find(selected) != nullptr)) {
+                activePlayer.theme_persistent = selected;
                 return GAME_STATE_ROUND;
             }
         } else if (selection[0] == '1') {
             theme_scroll++;
-            if (theme_scroll > this->themes.size() - 8) {
-                theme_scroll = this->themes.size() - 8;
+            if (theme_scroll > (int)this->themes.size() - 8) {
+                theme_scroll = std::max((int)this->themes.size() - 8, 0);
             }
         } else if (selection[0] == '2') {
             theme_scroll--;
@@ -660,24 +907,13 @@ int game::themeActor() {
                 theme_scroll = 0;
             }
         }
-    } while (true);
+    } while (this->running);
 
     return GAME_STATE_THEME;
 }
 
-std::list<word_info>& game::getThemeFromName(std::string __theme) {
-    for (std::list<word_info>& theme : this->themes) {
-        if (theme.front().word == __theme) {
-            return theme;
-        }
-    }
-
-    word_info identifier = {.word = __theme, .occurences = 0};
-    std::list<word_info> new_theme;
-
-    new_theme.push_back(identifier);
-    this->themes.push_back(new_theme);
-    return this->themes.back();
+theme_info& game::getThemeFromName(string_id __theme) {
+    return this->themes.add(__theme);
 }
 
 /*
@@ -694,11 +930,12 @@ int game::configActor() {
     int config_state = CONFIG_STATE_MENU;
     int config_scroll = 0;
     std::string config_name = "";
+    string_id config_theme = empty_string;
 
     do {
         if (config_state == CONFIG_STATE_MENU) {
             render(getImageAtIndex(20));
-            setCursorPos(10, 31);
+            commit(10, 31);
 
             std::string selection = getUserInput();
 
@@ -708,31 +945,41 @@ int game::configActor() {
 
             switch(selection[0]) {
             case '1':
-                setSelectionDelay(23, 18, 800);
+                setSelectionDelay(23, 18);
 
                 do {
                     render(getImageAtIndex(21));
-                    setCursorPos(10, 31);
+                    commit(10, 31);
                     config_name = getUserInput();
 
-                } while ((config_name.size() < 3) || (config_name.size() > 15));
+                } while (((config_name.size() < 3) || (config_name.size() > themecatalog::max_name_length)) && this->running);
+
+                // O input terminou sem um nome: nenhum tema é criado.
+                if (!this->running) {
+                    break;
+                }
 
                 config_state = CONFIG_STATE_MODIFY;
                 break;
             case '2':
-                setSelectionDelay(23, 20, 800);
+                setSelectionDelay(23, 20);
 
                 do {
                     render(getImageAtIndex(21));
-                    setCursorPos(10, 31);
+                    commit(10, 31);
                     config_name = getUserInput();
 
-                } while ((config_name.size() < 3) || (config_name.size() > 15));
+                } while (((config_name.size() < 3) || (config_name.size() > themecatalog::max_name_length)) && this->running);
+
+                // O input terminou sem um nome: nenhum tema é criado.
+                if (!this->running) {
+                    break;
+                }
 
                 config_state = CONFIG_STATE_MODIFY;
                 break;
             case '3':
-                setSelectionDelay(23, 22, 800);
+                setSelectionDelay(23, 22);
 
                 if (this->themes.size() <= 3) {
                     break;
@@ -740,57 +987,49 @@ int game::configActor() {
 
                 do {
                     render(getImageAtIndex(21));
-                    setCursorPos(10, 31);
+                    commit(10, 31);
                     config_name = getUserInput();
 
-                } while ((config_name.size() < 3) || (config_name.size() > 15));
+                } while (((config_name.size() < 3) || (config_name.size() > themecatalog::max_name_length)) && this->running);
 
-                this->themes.remove_if([&](std::list<word_info>& theme) {
-                    return theme.front().word == config_name;
-                });
+                if (!this->running) {
+                    break;
+                }
 
-                saveThemeData();
+                // O nome escrito só é procurado: um nome que não existe não é um tema.
+                if (stringpool::global().find(config_name, config_theme) && this->themes.remove(config_theme)) {
+                    this->hint_theme = empty_string;
+                    saveThemeData();
+                }
                 config_state = CONFIG_STATE_MENU;
                 break;
             case '4':
-                setSelectionDelay(23, 24, 800);
+                setSelectionDelay(23, 24);
                 config_state = CONFIG_STATE_EXIT;
                 break;
             }      
         } else if (config_state == CONFIG_STATE_MODIFY) {
-            std::list<word_info>& config_data = getThemeFromName(config_name);
+            theme_info& config_data = getThemeFromName(internString(config_name));
 
             render(getImageAtIndex(22));
-            setCursorPos(18, 5);
-            render(config_name, false);
-            setCursorPos(18, 7);
-            render(std::to_string(config_data.size() - 1), false);
-
-            int offset = 0;
-            auto word_iter = config_data.begin();
-            while ((offset < config_scroll + 1) && (word_iter != config_data.end())) {
-                offset++;
-                word_iter++;
-            }
+            stamp(18, 5, config_name);
+            stamp(18, 7, std::to_string(config_data.words.size()));
 
             for (int position = 0; position < 8; position++) {
-                if (word_iter != config_data.end()) {
-                    word_info& word = *word_iter;
-                    setCursorPos(45, 4 + position * 3);
-                    render(word.word, false);
-                    word_iter++;
-                }                
+                size_t index = position + config_scroll;
+                if (index < config_data.words.size()) {
+                    stamp(45, 4 + position * 3, getString(config_data.words[index].word));
+                }
 
                 if ((position + config_scroll) < 0) {
                     continue;
                 }
 
-                setCursorPos(40, 4 + position * 3);
-                render(std::to_string(position + config_scroll), false);
+                stamp(40, 4 + position * 3, std::to_string(position + config_scroll));
                 
             }
 
-            setCursorPos(10, 31);
+            commit(10, 31);
             std::string selection = getUserInput();
 
             if (selection.size() > 1) {
@@ -798,66 +1037,82 @@ int game::configActor() {
             }
 
             word_info config_word;
+            std::string config_text;
             bool exists = false;
 
             switch(selection[0]) {
             case '1':
-                setSelectionDelay(10, 22, 800);
-                setCursorPos(10, 31);
+                setSelectionDelay(10, 22);
+                commit(10, 31);
 
-                config_word.word = getUserInput();
+                config_text = getUserInput();
+                // O input terminou: a palavra vazia não é adicionada ao tema. Uma palavra vazia
+                // ou demasiado longa para a ronda também é ignorada.
+                if (!this->running || config_text.empty() || (config_text.size() > themecatalog::max_word_length)) {
+                    break;
+                }
+
+                config_word.word = internString(config_text);
                 config_word.occurences = 1;
 
-                for (word_info& word : config_data) {
+                for (word_info& word : config_data.words) {
                     if (word.word == config_word.word) {
                         exists = true;
                     }
                 }
 
                 if (!exists) {
-                    config_data.push_back(config_word);
+                    this->themes.describe(config_word.word);
+                    config_data.words.push_back(config_word);
+                    themecatalog::updateSampler(config_data);
+                    this->hint_theme = empty_string;
                 }
 
                 break;
             case '2':
-                setSelectionDelay(10, 24, 800);
+                setSelectionDelay(10, 24);
 
-                if (config_data.size() <= 9) {
+                if (config_data.words.size() <= 8) {
                     break;
                 }
 
-                setCursorPos(10, 31);
+                commit(10, 31);
 
-                config_word.word = getUserInput();
+                if (!stringpool::global().find(getUserInput(), config_word.word)) {
+                    break;
+                }
 
-                config_data.remove_if([&](const word_info& word) {
-                    return word.word == config_word.word;
-                });
+                config_data.words.erase(std::remove_if(config_data.words.begin(), config_data.words.end(),
+                    [&](const word_info& word) {
+                        return word.word == config_word.word;
+                    }), config_data.words.end());
+                themecatalog::updateSampler(config_data);
+                this->hint_theme = empty_string;
 
                 break;
             case '3':
-                setSelectionDelay(10, 26, 800);
+                setSelectionDelay(10, 26);
 
                 saveThemeData();
                 config_state = CONFIG_STATE_MENU;
                 break;
             case '4':
-                setSelectionDelay(44, 28, 800);
+                setSelectionDelay(44, 28);
                 config_scroll--;
                 if (config_scroll < 0) {
                     config_scroll = 0;
                 }
                 break;
             case '5':
-                setSelectionDelay(55, 28, 800);
+                setSelectionDelay(55, 28);
                 config_scroll++;
-                if (config_scroll > config_data.size() - 8) {
-                    config_scroll = config_data.size() - 8;
+                if (config_scroll > (int)config_data.words.size() - 8) {
+                    config_scroll = std::max((int)config_data.words.size() - 8, 0);
                 }
                 break;
             } 
         }
-    } while(config_state != CONFIG_STATE_EXIT);
+    } while((config_state != CONFIG_STATE_EXIT) && this->running);
 
     return GAME_STATE_MENU;
 }
@@ -870,101 +1125,78 @@ int game::configActor() {
 int game::roundActor() {
     render(getImageAtIndex(8));
 
-    player& activePlayer = getPlayerFromUsername(this->active_username);
-    std::string display_word;
+    player& activePlayer = getActivePlayer();
 
     if (activePlayer.score_runtime == 0) {
         activePlayer.gamemode_runtime = activePlayer.gamemode_persistent;
         activePlayer.difficulty_runtime = activePlayer.difficulty_persistent;
         activePlayer.theme_runtime = activePlayer.theme_persistent;
-        activePlayer.hidden_word = selectRandomWord(activePlayer.theme_runtime);
+        activePlayer.hidden_word = getString(selectRandomWord(activePlayer.theme_runtime));
         activePlayer.attempts = "";
     }
 
-    for(int i = 0; i < activePlayer.hidden_word.size(); i++) {
-        display_word += "_ ";
-    }
+    int multiplier = getDifficultyMultiplier(activePlayer.difficulty_runtime);
 
-    int multiplier = (activePlayer.difficulty_runtime == DIFFICULTY_EASY) * 3 
-        + (activePlayer.difficulty_runtime == DIFFICULTY_MEDIUM) * 5
-        + (activePlayer.difficulty_runtime == DIFFICULTY_HARD) * 8;
-
-    int unique = 0;
-    int correct = 0;
-    int fails = 0;
-
-    // Encontrar numero de carateres únicas na palavra secreta.
-    {    
-        std::unordered_set<char> temp;
-        for (int i = 0; i < activePlayer.hidden_word.size(); i++) {
-            temp.insert(activePlayer.hidden_word[i]);
-        }
-        unique = temp.size();
+    // Estado da ronda, retomando as tentativas já feitas numa ronda guardada. As letras de
+    // uma palavra do catálogo já são conhecidas; as restantes são calculadas.
+    roundstate round;
+    string_id hidden = empty_string;
+    const word_metadata* metadata = nullptr;
+    if (stringpool::global().find(activePlayer.hidden_word, hidden)) {
+        metadata = this->themes.getMetadata(hidden);
     }
 
-    for(int i = 0; i < activePlayer.attempts.size(); i++) { 
-        int occurences_hidden_word = std::count(
-            activePlayer.hidden_word.begin(),
-            activePlayer.hidden_word.end(),
-            activePlayer.attempts[i]
-        );
-        if (occurences_hidden_word == 0) {
-            fails++;
-        } else {
-            correct++;
-        }
+    if (metadata != nullptr) {
+        round.start(activePlayer.hidden_word, *metadata);
+    } else {
+        round.start(activePlayer.hidden_word);
     }
+    round.replay(activePlayer.attempts);
 
-    while((fails < 9) && (correct < unique)) {
-        render(getImageAtIndex(8 + fails));
+    while((round.getFails() < max_round_fails) && !round.isSolved() && this->running) {
+        render(getImageAtIndex(8 + round.getFails()));
         
         std::chrono::time_point<std::chrono::steady_clock> clock_start = std::chrono::steady_clock::now();
-       
-        std::string failed_attempts = "";
-        for(int i = 0; i < activePlayer.attempts.size(); i++) {
-            for(int j = 0; j < activePlayer.hidden_word.size(); j++) {
-                if (activePlayer.attempts[i] == activePlayer.hidden_word[j]) {
-                    display_word[j * 2] = activePlayer.attempts[i];
-                } else if (
-                    (failed_attempts.find(activePlayer.attempts[i]) > failed_attempts.size()) && 
-                    (activePlayer.hidden_word.find(activePlayer.attempts[i]) > activePlayer.hidden_word.size())
-                ) {
-                    failed_attempts += activePlayer.attempts[i];
-                }
-            }
-        }
+        const std::string& display_word = round.getDisplay();
 
-        setCursorPos(10, 4);
-        render(std::to_string(activePlayer.score_runtime), false);
+        stamp(10, 4, std::to_string(activePlayer.score_runtime));
 
-        setCursorPos(10, 6);
-        render(activePlayer.theme_persistent, false);
+        stamp(10, 6, getString(activePlayer.theme_persistent));
 
-        setCursorPos((int)map(display_word.size(), 0, 38, 36, 16), 29);
-        render(display_word, false);
+        stamp((int)map(display_word.size(), 0, 38, 36, 16), 29, display_word);
 
         if (activePlayer.gamemode_runtime >= GAMEMODE_BASIC) {
-            setCursorPos(10, 2);
-            render(std::to_string(activePlayer.time_runtime), false);
+            stamp(10, 2, std::to_string(activePlayer.time_runtime));
         } else {
-            setCursorPos(10, 2);
-            render("---", false);
+            stamp(10, 2, "---");
         }
 
         if (activePlayer.gamemode_runtime == GAMEMODE_MEDIUM) {
-            setCursorPos(56, 3);
-            render(failed_attempts, false);
+            stamp(56, 3, round.getFailed());
+        }
+
+        if (this->options.hints) {
+            char hint = getHint(activePlayer.theme_runtime, round);
+            if (hint != '\0') {
+                stamp(52, 12, std::string("Sugestao: ") + hint);
+            }
         }
 
-        setCursorPos(10, 31);
+        commit(10, 31);
         std::string answer = getUserInput();
 
+        // O input terminou (ex. fim de uma sessão reproduzida): a ronda fica como estava, sem
+        // contar a resposta vazia como falha.
+        if (!this->running) {
+            break;
+        }
+
         if (answer.size() > 1) {
             continue;
         } else if (answer[0] == '1') {
-            setSelectionDelay(57, 29, 800);
+            setSelectionDelay(57, 29);
             render(getImageAtIndex(2));
-            setCursorPos(10, 31);
+            commit(10, 31);
 
             std::string selection = getUserInput();
 
@@ -974,11 +1206,11 @@ int game::roundActor() {
             // Confirmção de saída
             switch(selection[0]) {
             case '1':
-                savePlayerData();
-                setSelectionDelay(23, 24, 800);
+                updatePlayerData(activePlayer);
+                setSelectionDelay(23, 24);
                 return GAME_STATE_MENU;
             case '2':
-                setSelectionDelay(40, 24, 800);
+                setSelectionDelay(40, 24);
                 break;
             }
             continue;
@@ -986,49 +1218,37 @@ int game::roundActor() {
 
         std::chrono::time_point<std::chrono::steady_clock> clock_end = std::chrono::steady_clock::now();
 
-        int occurences_hidden_word = std::count(
-            activePlayer.hidden_word.begin(),
-            activePlayer.hidden_word.end(),
-            answer[0]
-        );
-
-        int occurences_attempts = std::count(
-            activePlayer.attempts.begin(),
-            activePlayer.attempts.end(),
-            answer[0]
-        );
-
-        if ((occurences_hidden_word > 0) && (occurences_attempts == 0)) {
-            activePlayer.attempts += answer;
-            correct++;
-        } else if (occurences_attempts == 0) {
+        if (round.guess(answer[0]) != GUESS_REPEATED) {
             activePlayer.attempts += answer;
-            fails++;
         }
 
         std::chrono::duration<float> difference = (clock_end - clock_start);
         float duration = difference.count();
 
         activePlayer.time_runtime += duration;
-        activePlayer.score_runtime = (correct + map(duration, 0, 10, 1, -0.5)) * multiplier;
+        activePlayer.score_runtime = getRoundScore(round.getCorrect(), duration, multiplier);
         
-        savePlayerData();
+        updatePlayerData(activePlayer);
+    }
+
+    // O input terminou a meio da ronda, que fica guardada para ser retomada.
+    if (!this->running) {
+        return GAME_STATE_ROUND;
     }
 
-    if(fails == 9) {
+    int fails = round.getFails();
+
+    if(fails == max_round_fails) {
         render(getImageAtIndex(19));
     } else {
         render(getImageAtIndex(18));
 
-        setCursorPos(33,14);
-        render(std::to_string(activePlayer.score_runtime), false);
+        stamp(33,14, std::to_string(activePlayer.score_runtime));
 
-        setCursorPos(33,18);
-        render(std::to_string(fails), false);
+        stamp(33,18, std::to_string(fails));
 
         if(activePlayer.gamemode_runtime >= GAMEMODE_SIMPLE) {
-            setCursorPos(33,22);
-            render(std::to_string(activePlayer.time_runtime), false);
+            stamp(33,22, std::to_string(activePlayer.time_runtime));
         }
     }
 
@@ -1038,31 +1258,24 @@ int game::roundActor() {
     activePlayer.fails_persistent += fails;
 
     resetPlayerRuntimeData(activePlayer);
-    savePlayerData();
+    updatePlayerData(activePlayer);
+    flushThemeData(false);
 
-    setCursorPos(10,31);
+    commit(10, 31);
     std::string answer;
     do {
         answer = getUserInput();
-    } while (answer != "4");
+    } while ((answer != "4") && this->running);
 
     return GAME_STATE_MENU;
 }
 
 /*
-    Cada vez que é chamado, a imagem que está carregado no framebuffer é imprimido para o ecrã.
-    Tem uma especificação para limpar o conteúdo do ecrã dependendo do sistema operativo.
+    Iniciar a composição de um novo ecrã a partir de uma imagem, que substitui o conteúdo
+    anterior. Os textos são depois sobrepostos com "stamp" e o resultado enviado com "commit".
 */
-void game::render(std::string framebuffer, bool clearscreen) {
-    if (clearscreen) { 
-    #if defined(_WIN32)
-        system("cls");
-    #elif defined(__LINUX__) || defined(__gnu_linux__) || defined(__linux__)
-        system("clear");
-    #endif
-    }
-    std::cout.write(framebuffer.c_str(), framebuffer.size());
-    std::cout.flush();
+void game::render(std::string_view framebuffer) {
+    this->terminal.load(framebuffer);
 }
 
 /*
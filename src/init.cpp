@@ -1,9 +1,211 @@
 #include <iostream>
+#include <string>
+#include <cstdlib>
+#include <cerrno>
+#include <cstdint>
 
 #include "game.hpp"
+#include "replay.hpp"
+#include "simulator.hpp"
 
-int main() {
-    game new_game = game();
+/*
+    Opções disponíveis na linha de comandos. As variáveis de ambiente são lidas primeiro,
+    pelo que a linha de comandos tem sempre prioridade.
+
+        --fast              Desativar as animações de seleção (HANGMAN_FAST=1)
+        --delay <ms>        Duração das animações de seleção (HANGMAN_DELAY)
+        --images <ficheiro> Utilizar outro ficheiro de imagens (HANGMAN_IMAGES)
+        --record <ficheiro> Gravar o input da sessão interativa
+        --replay <ficheiro> Reproduzir uma sessão gravada, sem output, numa cópia dos dados
+        --sessions <n>      Número de reproduções da sessão (1 por omissão)
+        --binary-store      Guardar os jogadores em "players.bin" (HANGMAN_STORE=binary)
+        --lazy              Carregar cada jogador apenas quando necessário (HANGMAN_LAZY=1)
+        --hints             Sugerir a próxima letra durante a ronda (HANGMAN_HINTS=1)
+        --seed <n>          Semente dos sorteios, para repetir o jogo ou a simulação (HANGMAN_SEED)
+        --sim <rondas>      Simular rondas sem interface, em todos os núcleos (modo "hangman-sim")
+        --threads <n>       Número de threads da simulação (uma por núcleo por omissão)
+        --sim-sessions <n>  Número de sessões independentes da simulação (64 por omissão)
+        --skill <0-100>     Percentagem das tentativas simuladas que seguem o "solver" (75)
+        --convert-players <origem> <destino>
+                            Converter os jogadores entre texto e binário (destino ".bin")
+*/
+struct launch_options {
+    std::string replay_filename = "";
+    int replay_sessions = 1;
+    std::string convert_source = "";
+    std::string convert_destination = "";
+    bool simulate = false;
+    sim_options simulation;
+};
+
+void printUsage(const char* program) {
+    std::cout << "Utilizacao: " << program << " [--fast] [--delay <ms>] [--images <ficheiro>]"
+        << " [--record <ficheiro>] [--replay <ficheiro> [--sessions <n>]] [--binary-store] [--lazy] [--hints] [--seed <n>]"
+        << " [--convert-players <origem> <destino>] [--sim <rondas> [--threads <n>] [--sim-sessions <n>] [--skill <0-100>]]\n";
+}
+
+bool parseDelay(const char* value, int& delay) {
+    char* end = nullptr;
+    long parsed = strtol(value, &end, 10);
+
+    if ((end == value) || (*end != '\0') || (parsed < 0) || (parsed > 60000)) {
+        std::cout << "Erro: Duracao invalida \'" << value << "\'\n";
+        return false;
+    }
+
+    delay = parsed;
+    return true;
+}
+
+bool parseCount(const char* value, int& count) {
+    char* end = nullptr;
+    long parsed = strtol(value, &end, 10);
+
+    if ((end == value) || (*end != '\0') || (parsed < 0) || (parsed > 100000000)) {
+        std::cout << "Erro: Numero invalido \'" << value << "\'\n";
+        return false;
+    }
+
+    count = parsed;
+    return true;
+}
+
+bool parseSeed(const char* value, game_options& options) {
+    char* end = nullptr;
+    errno = 0;
+    unsigned long long parsed = strtoull(value, &end, 10);
+
+    if ((end == value) || (*end != '\0') || (*value == '-') || (errno == ERANGE)) {
+        std::cout << "Erro: Semente invalida \'" << value << "\'\n";
+        return false;
+    }
+
+    options.seed = parsed;
+    options.has_seed = true;
+    return true;
+}
+
+bool loadEnvironmentOptions(game_options& options) {
+    const char* fast = getenv("HANGMAN_FAST");
+    const char* delay = getenv("HANGMAN_DELAY");
+    const char* images = getenv("HANGMAN_IMAGES");
+    const char* store = getenv("HANGMAN_STORE");
+    const char* lazy = getenv("HANGMAN_LAZY");
+    const char* hints = getenv("HANGMAN_HINTS");
+    const char* seed = getenv("HANGMAN_SEED");
+
+    if ((delay != nullptr) && !parseDelay(delay, options.selection_delay)) {
+        return false;
+    }
+
+    if ((fast != nullptr) && (std::string(fast) != "0")) {
+        options.selection_delay = 0;
+    }
+
+    if (images != nullptr) {
+        options.images_filename = images;
+    }
+
+    if (store != nullptr) {
+        options.binary_store = (std::string(store) == "binary");
+    }
+
+    if ((lazy != nullptr) && (std::string(lazy) != "0")) {
+        options.lazy_loading = true;
+    }
+
+    if ((hints != nullptr) && (std::string(hints) != "0")) {
+        options.hints = true;
+    }
+
+    if ((seed != nullptr) && !parseSeed(seed, options)) {
+        return false;
+    }
+
+    return true;
+}
+
+bool loadCommandLineOptions(int argc, char** argv, game_options& options, launch_options& launch) {
+    for (int i = 1; i < argc; i++) {
+        std::string argument = argv[i];
+
+        if (argument == "--fast") {
+            options.selection_delay = 0;
+        } else if ((argument == "--delay") && (i + 1 < argc)) {
+            if (!parseDelay(argv[++i], options.selection_delay)) {
+                return false;
+            }
+        } else if ((argument == "--images") && (i + 1 < argc)) {
+            options.images_filename = argv[++i];
+        } else if ((argument == "--record") && (i + 1 < argc)) {
+            options.record_filename = argv[++i];
+        } else if ((argument == "--replay") && (i + 1 < argc)) {
+            launch.replay_filename = argv[++i];
+        } else if (argument == "--binary-store") {
+            options.binary_store = true;
+        } else if (argument == "--lazy") {
+            options.lazy_loading = true;
+        } else if (argument == "--hints") {
+            options.hints = true;
+        } else if ((argument == "--seed") && (i + 1 < argc)) {
+            if (!parseSeed(argv[++i], options)) {
+                return false;
+            }
+        } else if ((argument == "--convert-players") && (i + 2 < argc)) {
+            launch.convert_source = argv[++i];
+            launch.convert_destination = argv[++i];
+        } else if ((argument == "--sim") && (i + 1 < argc)) {
+            launch.simulate = true;
+            if (!parseCount(argv[++i], launch.simulation.rounds)) {
+                return false;
+            }
+        } else if ((argument == "--threads") && (i + 1 < argc)) {
+            if (!parseCount(argv[++i], launch.simulation.threads)) {
+                return false;
+            }
+        } else if ((argument == "--sim-sessions") && (i + 1 < argc)) {
+            if (!parseCount(argv[++i], launch.simulation.sessions) || (launch.simulation.sessions == 0)) {
+                return false;
+            }
+        } else if ((argument == "--skill") && (i + 1 < argc)) {
+            if (!parseCount(argv[++i], launch.simulation.skill) || (launch.simulation.skill > 100)) {
+                return false;
+            }
+        } else if ((argument == "--sessions") && (i + 1 < argc)) {
+            if (!parseCount(argv[++i], launch.replay_sessions)) {
+                return false;
+            }
+        } else {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int main(int argc, char** argv) {
+    game_options options;
+    launch_options launch;
+
+    if (!loadEnvironmentOptions(options) || !loadCommandLineOptions(argc, argv, options, launch)) {
+        printUsage(argv[0]);
+        return -1;
+    }
+
+    if (launch.convert_source != "") {
+        return convertPlayerData(launch.convert_source, launch.convert_destination) ? 0 : -1;
+    }
+
+    if (launch.simulate) {
+        launch.simulation.seed = options.has_seed ? options.seed : time(NULL);
+        return runSimulation(launch.simulation);
+    }
+
+    if (launch.replay_filename != "") {
+        return runReplay(options, launch.replay_filename, launch.replay_sessions);
+    }
+
+    game new_game = game(options);
 
     new_game.run();
 
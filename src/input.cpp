@@ -0,0 +1,66 @@
+#include "input.hpp"
+
+terminal_input::terminal_input(std::string record_filename) {
+    if (record_filename != "") {
+        this->record.open(record_filename, std::ios::app);
+        if (!this->record.is_open()) {
+            std::cout << "Erro: Nao foi possivel abrir o ficheiro \'" << record_filename << "\'\n";
+        }
+    }
+}
+
+bool terminal_input::next(std::string& token) {
+    if (!(std::cin >> token)) {
+        return false;
+    }
+
+    if (this->record.is_open()) {
+        this->record << token << std::endl;
+    }
+    return true;
+}
+
+script_input::script_input(std::vector<std::string> __tokens) {
+    this->tokens = std::move(__tokens);
+    this->position = 0;
+}
+
+bool script_input::next(std::string& token) {
+    if (this->position >= this->tokens.size()) {
+        return false;
+    }
+
+    token = this->tokens[this->position++];
+    return true;
+}
+
+file_input::file_input(std::string filename) {
+    this->file.open(filename);
+    if (!this->file.is_open()) {
+        std::cout << "Erro: Nao foi possivel abrir o ficheiro \'" << filename << "\'\n";
+    }
+}
+
+bool file_input::is_open() const {
+    return this->file.is_open();
+}
+
+bool file_input::next(std::string& token) {
+    return (bool)(this->file >> token);
+}
+
+/*
+    Carregar todos os tokens de um ficheiro de sessão, para serem reproduzidos com "script_input".
+*/
+bool loadSessionFile(std::string filename, std::vector<std::string>& tokens) {
+    file_input session(filename);
+    if (!session.is_open()) {
+        return false;
+    }
+
+    std::string token;
+    while (session.next(token)) {
+        tokens.push_back(token);
+    }
+    return true;
+}
@@ -1,36 +1,276 @@
 #include "io.hpp"
 
+#include <cerrno>
+#include <cstdio>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+mappedfile::mappedfile() {
+    this->address = nullptr;
+    this->length = 0;
+    this->mapped = false;
+}
+
+mappedfile::~mappedfile() {
+    close();
+}
+
+bool mappedfile::fail(std::string message) {
+    this->last_error = message;
+    return false;
+}
+
+const std::string& mappedfile::error() const {
+    return this->last_error;
+}
+
+std::string_view mappedfile::view() const {
+    return std::string_view(this->address, this->length);
+}
+
+void mappedfile::close() {
+#if !defined(_WIN32)
+    if (this->mapped) {
+        munmap((void*)this->address, this->length);
+    }
+#endif
+    this->fallback.clear();
+    this->address = nullptr;
+    this->length = 0;
+    this->mapped = false;
+}
+
 /*
-    Obter o conteúdo de um ficheiro e guardar num stringstream.
-    Facilita a eventual extração da informação através dos seus operadores sobrecarregados.
+    Mapear um ficheiro em memória. Um ficheiro vazio resulta numa vista vazia.
 */
-std::stringstream getFileData(std::string filename) {
+bool mappedfile::open(std::string filename) {
+    close();
+
+#if !defined(_WIN32)
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return fail("Nao foi possivel abrir o ficheiro \'" + filename + "\'");
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        ::close(fd);
+        return fail("Nao foi possivel ler o ficheiro \'" + filename + "\'");
+    }
+
+    if (info.st_size > 0) {
+        void* mapping = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping != MAP_FAILED) {
+            this->address = (const char*)mapping;
+            this->length = info.st_size;
+            this->mapped = true;
+        }
+    }
+    ::close(fd);
+
+    if (this->mapped || (info.st_size == 0)) {
+        return true;
+    }
+#endif
+
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        return fail("Nao foi possivel abrir o ficheiro \'" + filename + "\'");
+    }
+
     std::stringstream data;
-    std::ifstream file;
+    data << file.rdbuf();
+    this->fallback = data.str();
+    this->address = this->fallback.data();
+    this->length = this->fallback.size();
+    return true;
+}
+
+filewriter::filewriter() {
+    this->fd = -1;
+    this->appending = false;
+}
+
+filewriter::~filewriter() {
+    discard();
+}
+
+bool filewriter::fail(std::string message) {
+    this->last_error = message;
+    return false;
+}
 
-    file.open(filename);
-    if (file.is_open()) {
-        data << file.rdbuf();
-        file.close();
-    } else {
-        std::cout << "Erro: Nao foi possivel abrir o ficheiro \'" << filename << "\'\n";
-        exit(-1);
+const std::string& filewriter::error() const {
+    return this->last_error;
+}
+
+/*
+    Abrir um ficheiro para escrita. Com "append" os dados são acrescentados ao fim do ficheiro,
+    caso contrário o ficheiro é substituído por completo ao fechar.
+*/
+bool filewriter::open(std::string __filename, bool append) {
+    discard();
+
+    this->filename = __filename;
+    this->temporary = __filename + ".tmp";
+    this->appending = append;
+
+    std::string target = append ? this->filename : this->temporary;
+
+#if defined(_WIN32)
+    this->stream.open(target, std::ios::binary | (append ? std::ios::app : std::ios::trunc));
+    if (!this->stream.is_open()) {
+        return fail("Nao foi possivel abrir o ficheiro \'" + target + "\'");
+    }
+#else
+    this->fd = ::open(target.c_str(), O_WRONLY | O_CREAT | (append ? O_APPEND : O_TRUNC), 0644);
+    if (this->fd < 0) {
+        return fail("Nao foi possivel abrir o ficheiro \'" + target + "\'");
     }
-    return data;
+#endif
+    return true;
+}
+
+bool filewriter::writeDirect(std::string_view data) {
+#if defined(_WIN32)
+    this->stream.write(data.data(), data.size());
+    if (!this->stream) {
+        return fail("Nao foi possivel escrever o ficheiro \'" + this->filename + "\'");
+    }
+#else
+    size_t written = 0;
+    while (written < data.size()) {
+        ssize_t result = ::write(this->fd, data.data() + written, data.size() - written);
+        if ((result < 0) && (errno == EINTR)) {
+            continue;
+        } else if (result <= 0) {
+            return fail("Nao foi possivel escrever o ficheiro \'" + this->filename + "\'");
+        }
+        written += result;
+    }
+#endif
+    return true;
+}
+
+/*
+    Acumular "data" no bloco intermédio. Dados maiores do que o bloco são escritos diretamente.
+*/
+bool filewriter::write(std::string_view data) {
+    if (this->buffer.size() + data.size() <= buffer_size) {
+        this->buffer.append(data);
+        return true;
+    }
+
+    if (!flush()) {
+        return false;
+    }
+
+    if (data.size() >= buffer_size) {
+        return writeDirect(data);
+    }
+
+    this->buffer.append(data);
+    return true;
+}
+
+bool filewriter::flush() {
+    if (this->buffer.empty()) {
+        return true;
+    }
+
+    bool written = writeDirect(this->buffer);
+    this->buffer.clear();
+    return written;
+}
+
+/*
+    Escrever os dados pendentes, sincronizar o ficheiro com o disco e, ao substituir,
+    trocar o original pelo temporário.
+*/
+bool filewriter::close() {
+    bool written = flush();
+
+#if defined(_WIN32)
+    if (!this->stream.is_open()) {
+        return fail("O ficheiro nao esta aberto");
+    }
+    this->stream.close();
+    written = written && !this->stream.fail();
+
+    if (written && !this->appending) {
+        std::remove(this->filename.c_str());
+        written = (std::rename(this->temporary.c_str(), this->filename.c_str()) == 0);
+    }
+#else
+    if (this->fd < 0) {
+        return fail("O ficheiro nao esta aberto");
+    }
+    written = written && (fsync(this->fd) == 0);
+    written = (::close(this->fd) == 0) && written;
+    this->fd = -1;
+
+    if (written && !this->appending) {
+        written = (rename(this->temporary.c_str(), this->filename.c_str()) == 0);
+    }
+#endif
+
+    if (!written) {
+        if (!this->appending) {
+            std::remove(this->temporary.c_str());
+        }
+        return fail("Nao foi possivel escrever o ficheiro \'" + this->filename + "\'");
+    }
+    return true;
 }
 
 /*
-    Guardar o conteúdo de um stringstream num ficheiro.
+    Abandonar a escrita em curso. Ao substituir, o ficheiro original não é alterado.
 */
-void setFileData(std::string filename, std::stringstream& data) {
-    std::ofstream file;
+void filewriter::discard() {
+#if defined(_WIN32)
+    bool open = this->stream.is_open();
+    this->stream.close();
+#else
+    bool open = (this->fd >= 0);
+    if (open) {
+        ::close(this->fd);
+    }
+    this->fd = -1;
+#endif
 
-    file.open(filename);
-    if (file.is_open()) {
-        file << data.str();
-        file.close();
-    } else {
-        std::cout << "Erro: Nao foi possivel abrir o ficheiro \'" << filename << "\'\n";
-        exit(-1);
+    if (open && !this->appending) {
+        std::remove(this->temporary.c_str());
     }
+    this->buffer.clear();
+}
+
+/*
+    Verificar se um ficheiro existe e pode ser aberto para leitura.
+*/
+bool hasFileData(std::string filename) {
+    std::ifstream file(filename);
+    return file.is_open();
+}
+
+/*
+    Substituir o conteúdo de um ficheiro de forma atómica: os dados são escritos num ficheiro
+    temporário, sincronizados com o disco e só depois o temporário substitui o original.
+    Uma interrupção a meio deixa sempre o ficheiro anterior ou o novo, nunca um ficheiro parcial.
+*/
+bool replaceFileData(std::string filename, std::string_view data) {
+    filewriter file;
+    return file.open(filename) && file.write(data) && file.close();
+}
+
+/*
+    Acrescentar o conteúdo de "data" ao fim de um ficheiro, criando-o caso não exista.
+*/
+bool appendFileData(std::string filename, std::string_view data) {
+    filewriter file;
+    return file.open(filename, true) && file.write(data) && file.close();
 }
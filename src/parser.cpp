@@ -0,0 +1,115 @@
+#include "parser.hpp"
+
+#include <charconv>
+
+static bool isSeparator(char c) {
+    return (c == ' ') || (c == '\n') || (c == '\t') || (c == '\r') || (c == '\v') || (c == '\f');
+}
+
+textparser::textparser(std::string_view __data, std::string __name, int __line) {
+    this->data = __data;
+    this->name = __name;
+    this->position = 0;
+    this->line = __line;
+}
+
+bool textparser::fail(std::string_view field, std::string message) {
+    this->last_error = "O ficheiro \'" + this->name + "\' tem " + message + " na linha "
+        + std::to_string(this->line) + " (" + std::string(field) + ")";
+    return false;
+}
+
+const std::string& textparser::error() const {
+    return this->last_error;
+}
+
+size_t textparser::getPosition() const {
+    return this->position;
+}
+
+/*
+    Avançar até ao próximo campo e devolver uma vista sobre ele.
+    A vista é válida enquanto o texto analisado existir.
+*/
+bool textparser::nextToken(std::string_view& token, std::string_view field) {
+    while ((this->position < this->data.size()) && isSeparator(this->data[this->position])) {
+        this->line += (this->data[this->position] == '\n');
+        this->position++;
+    }
+
+    size_t start = this->position;
+    while ((this->position < this->data.size()) && !isSeparator(this->data[this->position])) {
+        this->position++;
+    }
+
+    if (start == this->position) {
+        return fail(field, "um campo em falta");
+    }
+
+    token = this->data.substr(start, this->position - start);
+    return true;
+}
+
+/*
+    Ler o próximo campo, que não pode ter mais de "max_length" carateres.
+*/
+bool textparser::nextToken(std::string_view& token, std::string_view field, size_t max_length) {
+    if (!nextToken(token, field)) {
+        return false;
+    }
+    if (token.size() > max_length) {
+        return fail(field, "um campo com mais de " + std::to_string(max_length) + " carateres");
+    }
+    return true;
+}
+
+// Converter um campo inteiro num número, aceitando o sinal "+" tal como o operador ">>".
+template <typename number>
+static bool parseNumber(std::string_view token, number& value) {
+    const char* first = token.data() + ((token[0] == '+') && (token.size() > 1));
+    const char* last = token.data() + token.size();
+
+    std::from_chars_result result = std::from_chars(first, last, value);
+    return (result.ec == std::errc()) && (result.ptr == last);
+}
+
+bool textparser::nextInt(int& value, std::string_view field) {
+    std::string_view token;
+    if (!nextToken(token, field)) {
+        return false;
+    } else if (!parseNumber(token, value)) {
+        return fail(field, "um numero invalido \'" + std::string(token) + "\'");
+    }
+    return true;
+}
+
+bool textparser::nextInt(long long& value, std::string_view field) {
+    std::string_view token;
+    if (!nextToken(token, field)) {
+        return false;
+    } else if (!parseNumber(token, value)) {
+        return fail(field, "um numero invalido \'" + std::string(token) + "\'");
+    }
+    return true;
+}
+
+bool textparser::nextFloat(float& value, std::string_view field) {
+    std::string_view token;
+    if (!nextToken(token, field)) {
+        return false;
+    } else if (!parseNumber(token, value)) {
+        return fail(field, "um numero invalido \'" + std::string(token) + "\'");
+    }
+    return true;
+}
+
+/*
+    Verificar se restam apenas separadores até ao fim do texto.
+*/
+bool textparser::atEnd() {
+    while ((this->position < this->data.size()) && isSeparator(this->data[this->position])) {
+        this->line += (this->data[this->position] == '\n');
+        this->position++;
+    }
+    return this->position == this->data.size();
+}
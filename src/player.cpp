@@ -1,5 +1,7 @@
 #include "player.hpp"
+#include "io.hpp"
 #include <iostream>
+#include <limits>
 
 player::player(std::string __username) {
 	// Persistent data
@@ -10,15 +12,16 @@ player::player(std::string __username) {
     time_persistent = 0;
     gamemode_persistent = GAMEMODE_SIMPLE;
     difficulty_persistent = DIFFICULTY_EASY;
-    theme_persistent = "";
+    theme_persistent = empty_string;
 	// Runtime data
     gamemode_runtime = GAMEMODE_SIMPLE;
     difficulty_runtime = DIFFICULTY_EASY;
-    theme_runtime = "";
+    theme_runtime = empty_string;
 	score_runtime = 0;
 	time_runtime = 0;
     hidden_word = "";
     attempts = "";
+    store_index = -1;
 }
 
 player::~player() {
@@ -26,6 +29,8 @@ player::~player() {
 }
 
 player& player::fromRawPlayerData(std::stringstream& data) {
+    std::string theme;
+
     data >> this->username
         >> this->score_persistent
         >> this->rounds_persistent
@@ -33,19 +38,13 @@ player& player::fromRawPlayerData(std::stringstream& data) {
         >> this->time_persistent
         >> this->gamemode_persistent
         >> this->difficulty_persistent
-        >> this->theme_persistent
+        >> theme
         >> this->score_runtime
         >> this->time_runtime
         >> this->hidden_word
         >> this->attempts;
 
-    if (this->theme_persistent == "none") {
-        this->theme_persistent = "";
-    }
-
-    if (this->theme_runtime == "none") {
-        this->theme_runtime = "";
-    }
+    this->theme_persistent = (theme == "none") ? empty_string : internString(theme);
 
     if (this->hidden_word == "none") {
         this->hidden_word = "";
@@ -58,21 +57,54 @@ player& player::fromRawPlayerData(std::stringstream& data) {
     return *this;
 }
 
-player& player::toRawPlayerData(std::stringstream& data) {
-    if (this->theme_persistent == "") {
-        this->theme_persistent = "none";
-    }
+/*
+    Ler os dados de um jogador no mesmo formato de "fromRawPlayerData", sem cópias intermédias.
+    Em caso de erro o jogador fica incompleto e o erro é indicado pelo leitor.
+*/
+bool player::parseRawPlayerData(textparser& data) {
+    std::string_view username;
+    std::string_view theme;
+    std::string_view hidden_word;
+    std::string_view attempts;
 
-    if (this->theme_runtime == "") {
-        this->theme_runtime = "none";
+    if (!data.nextToken(username, "nome")
+        || !data.nextInt(this->score_persistent, "pontuacao")
+        || !data.nextInt(this->rounds_persistent, "jogos")
+        || !data.nextInt(this->fails_persistent, "falhas")
+        || !data.nextFloat(this->time_persistent, "tempo")
+        || !data.nextInt(this->gamemode_persistent, "modo de jogo")
+        || !data.nextInt(this->difficulty_persistent, "dificuldade")
+        || !data.nextToken(theme, "tema")
+        || !data.nextInt(this->score_runtime, "pontuacao da ronda")
+        || !data.nextInt(this->time_runtime, "tempo da ronda")
+        || !data.nextToken(hidden_word, "palavra")
+        || !data.nextToken(attempts, "tentativas")) {
+        return false;
     }
 
+    this->username.assign(username);
+    this->theme_persistent = (theme == "none") ? empty_string : internString(theme);
+    this->hidden_word.assign(hidden_word == "none" ? std::string_view() : hidden_word);
+    this->attempts.assign(attempts == "none" ? std::string_view() : attempts);
+
+    return true;
+}
+
+player& player::toRawPlayerData(std::stringstream& data) {
     if (this->hidden_word == "") {
         this->hidden_word = "none";
     }
     if (this->attempts == "") {
         this->attempts = "none";
     }
+    std::string_view theme = "none";
+    if (this->theme_persistent != empty_string) {
+        theme = getString(this->theme_persistent);
+    }
+
+    // Precisão suficiente para que o tempo total seja recuperado sem perdas.
+    std::streamsize precision = data.precision(std::numeric_limits<float>::max_digits10);
+
     data << this->username                  << '\n'
         << this->score_persistent           << '\n'
         << this->rounds_persistent          << '\n'
@@ -80,19 +112,13 @@ player& player::toRawPlayerData(std::stringstream& data) {
         << this->time_persistent            << '\n'
         << this->gamemode_persistent        << '\n'
         << this->difficulty_persistent      << '\n'
-        << this->theme_persistent           << '\n'
+        << theme                            << '\n'
         << this->score_runtime              << '\n'
         << this->time_runtime               << '\n'
         << this->hidden_word                << '\n'
         << this->attempts                   << '\n';
-    
-    if (this->theme_persistent == "none") {
-        this->theme_persistent = "";
-    }
 
-    if (this->theme_runtime == "none") {
-        this->theme_runtime = "";
-    }
+    data.precision(precision);
 
     if (this->hidden_word == "none") {
         this->hidden_word = "";
@@ -103,4 +129,42 @@ player& player::toRawPlayerData(std::stringstream& data) {
     }
     
     return *this;
-}
\ No newline at end of file
+}
+
+/*
+    Aplicar por ordem as entradas do diário de jogadores "filename" (ex. "players.journal"),
+    uma por linha, com os mesmos campos de "players.txt". Cada entrada é lida isoladamente:
+    uma entrada inválida é reportada e ignorada, tal como uma última entrada incompleta
+    (ex. interrompida a meio da escrita). Um diário inexistente ou vazio não tem entradas.
+*/
+bool readPlayerJournal(std::string filename, const std::function<void(const player&)>& apply, std::string& error) {
+    if (!hasFileData(filename)) {
+        return true;
+    }
+
+    mappedfile journal;
+    if (!journal.open(filename)) {
+        error = journal.error();
+        return false;
+    }
+
+    std::string_view entries = journal.view();
+    size_t start = 0;
+    size_t end = entries.find('\n');
+    for (int line = 1; end != std::string_view::npos; line++) {
+        textparser entry(entries.substr(start, end - start), filename, line);
+        player loaded;
+
+        if (loaded.parseRawPlayerData(entry) && entry.atEnd()) {
+            apply(loaded);
+        } else if (entry.error() != "") {
+            std::cout << "Aviso: " << entry.error() << "\n";
+        } else {
+            std::cout << "Aviso: O ficheiro \'" << filename << "\' tem campos a mais na linha " << line << "\n";
+        }
+
+        start = end + 1;
+        end = entries.find('\n', start);
+    }
+    return true;
+}
@@ -0,0 +1,250 @@
+#include "playerindex.hpp"
+#include "io.hpp"
+
+#include <sys/stat.h>
+
+// Número de campos de cada registo de "players.txt".
+static const int player_fields = 12;
+
+static bool getFileStamp(const std::string& filename, long long& size, long long& modified) {
+    struct stat info;
+    if (stat(filename.c_str(), &info) != 0) {
+        return false;
+    }
+    size = info.st_size;
+#if defined(__linux__)
+    modified = (long long)info.st_mtim.tv_sec * 1000000000LL + info.st_mtim.tv_nsec;
+#else
+    modified = info.st_mtime;
+#endif
+    return true;
+}
+
+/*
+    Carregar o índice de "__index_filename" se corresponder ao estado atual de "__filename",
+    ou construí-lo percorrendo o ficheiro dos jogadores (e guardá-lo para a próxima execução).
+*/
+bool playerindex::build(std::string __filename, std::string __index_filename) {
+    this->filename = __filename;
+    this->index_filename = __index_filename;
+    this->entries.clear();
+    this->positions.clear();
+
+    if (!hasFileData(this->filename)) {
+        return true;
+    }
+
+    if (loadIndexFile()) {
+        return true;
+    }
+
+    mappedfile file;
+    if (!file.open(this->filename)) {
+        std::cout << "Erro: " << file.error() << "\n";
+        return false;
+    }
+
+    if (!scan(file.view())) {
+        return false;
+    }
+    return save();
+}
+
+/*
+    Reconstruir o índice a partir do conteúdo que vai substituir o ficheiro dos jogadores.
+    O ficheiro do índice só deve ser guardado depois de o ficheiro dos jogadores estar escrito.
+*/
+bool playerindex::assign(std::string_view data) {
+    return scan(data);
+}
+
+/*
+    Percorrer os campos de cada registo sem os interpretar, guardando apenas a posição, o
+    nome e a pontuação de cada jogador.
+*/
+bool playerindex::scan(std::string_view data) {
+    this->entries.clear();
+    this->positions.clear();
+
+    textparser parser(data, this->filename);
+    if (parser.atEnd()) {
+        return true;
+    }
+
+    int playerCount = 0;
+    if (!parser.nextInt(playerCount, "numero de jogadores")) {
+        std::cout << "Erro: " << parser.error() << "\n";
+        return false;
+    }
+    this->entries.reserve(playerCount);
+
+    for (int i = 0; i < playerCount; i++) {
+        player_entry entry;
+        entry.loaded = false;
+
+        std::string_view token;
+        bool valid = parser.nextToken(token, "nome");
+        entry.offset = token.data() - data.data();
+        entry.username.assign(token);
+
+        valid = valid && parser.nextInt(entry.score, "pontuacao");
+        for (int field = 2; valid && (field < player_fields); field++) {
+            valid = parser.nextToken(token, "jogador");
+        }
+
+        if (!valid) {
+            std::cout << "Erro: " << parser.error() << "\n";
+            return false;
+        }
+        entry.length = parser.getPosition() - entry.offset;
+
+        this->positions[entry.username] = this->entries.size();
+        this->entries.push_back(std::move(entry));
+    }
+
+    return true;
+}
+
+bool playerindex::loadIndexFile() {
+    long long size = 0;
+    long long modified = 0;
+    mappedfile file;
+    if (!getFileStamp(this->filename, size, modified) || !file.open(this->index_filename)) {
+        return false;
+    }
+
+    textparser data(file.view(), this->index_filename);
+    long long indexed_size = -1;
+    long long indexed_modified = -1;
+    long long count = 0;
+
+    if (!data.nextInt(indexed_size, "tamanho") || !data.nextInt(indexed_modified, "data")
+        || !data.nextInt(count, "numero de jogadores") || (indexed_size != size) || (indexed_modified != modified)) {
+        return false;
+    }
+
+    this->entries.reserve(count);
+    for (long long i = 0; i < count; i++) {
+        player_entry entry;
+        entry.loaded = false;
+
+        std::string_view username;
+        long long offset = 0;
+        long long length = 0;
+        if (!data.nextToken(username, "nome") || !data.nextInt(offset, "posicao")
+            || !data.nextInt(length, "tamanho") || !data.nextInt(entry.score, "pontuacao")) {
+            this->entries.clear();
+            this->positions.clear();
+            return false;
+        }
+        entry.username.assign(username);
+        entry.offset = offset;
+        entry.length = length;
+
+        this->positions[entry.username] = this->entries.size();
+        this->entries.push_back(std::move(entry));
+    }
+
+    return true;
+}
+
+/*
+    Guardar o índice, associado ao tamanho e à data de modificação atuais do ficheiro dos jogadores.
+*/
+bool playerindex::save() {
+    long long size = 0;
+    long long modified = 0;
+    if (!getFileStamp(this->filename, size, modified)) {
+        return false;
+    }
+
+    std::stringstream data;
+    data << size << " " << modified << " " << this->entries.size() << "\n";
+    for (player_entry& entry : this->entries) {
+        data << entry.username << " " << entry.offset << " " << entry.length << " " << entry.score << "\n";
+    }
+
+    return replaceFileData(this->index_filename, data.str());
+}
+
+player_entry* playerindex::find(const std::string& username) {
+    auto position = this->positions.find(username);
+    if (position == this->positions.end()) {
+        return nullptr;
+    }
+    return &this->entries[position->second];
+}
+
+/*
+    Ler o texto de um registo diretamente da sua posição no ficheiro dos jogadores.
+*/
+bool playerindex::readRaw(const player_entry& entry, std::string& raw) {
+    std::ifstream file(this->filename, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    raw.resize(entry.length);
+    file.seekg(entry.offset);
+    file.read(&raw[0], entry.length);
+    return (bool)file;
+}
+
+/*
+    Percorrer o texto dos registos dos jogadores ainda não carregados (ex. ao compactar),
+    abrindo o ficheiro dos jogadores uma única vez. Se algum registo não puder ser lido,
+    nenhum é percorrido e é devolvido false.
+*/
+bool playerindex::readUnloaded(const std::function<void(std::string_view raw)>& function) {
+    bool pending = false;
+    for (const player_entry& entry : this->entries) {
+        pending |= !entry.loaded;
+    }
+    if (!pending) {
+        return true;
+    }
+
+    mappedfile file;
+    if (!file.open(this->filename)) {
+        std::cout << "Erro: " << file.error() << "\n";
+        return false;
+    }
+
+    std::string_view data = file.view();
+    for (const player_entry& entry : this->entries) {
+        if (!entry.loaded && ((entry.offset > data.size()) || (entry.length > data.size() - entry.offset))) {
+            std::cout << "Erro: O registo do jogador \'" << entry.username << "\' nao existe em \'"
+                << this->filename << "\'\n";
+            return false;
+        }
+    }
+
+    for (const player_entry& entry : this->entries) {
+        if (!entry.loaded) {
+            function(data.substr(entry.offset, entry.length));
+        }
+    }
+    return true;
+}
+
+bool playerindex::read(const player_entry& entry, player& target) {
+    std::string raw;
+    if (!readRaw(entry, raw)) {
+        return false;
+    }
+
+    textparser data(raw, this->filename);
+    if (!target.parseRawPlayerData(data)) {
+        std::cout << "Erro: " << data.error() << "\n";
+        return false;
+    }
+    return true;
+}
+
+std::vector<player_entry>& playerindex::getEntries() {
+    return this->entries;
+}
+
+size_t playerindex::size() const {
+    return this->entries.size();
+}
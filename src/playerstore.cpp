@@ -0,0 +1,418 @@
+#include "playerstore.hpp"
+#include "io.hpp"
+#include "roundstate.hpp"
+#include "themecatalog.hpp"
+
+#include <cstring>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+static const char playerstore_magic[8] = {'H', 'A', 'N', 'G', 'P', 'L', 'R', '\0'};
+
+static_assert(sizeof(playerstore_header) <= playerstore::header_size);
+
+// Os campos de tamanho fixo têm de guardar, com o terminador, os maiores valores que o jogo
+// aceita: a palavra é uma palavra ou o nome de um tema vazio, e as tentativas são no máximo
+// as letras da palavra e as falhas da ronda.
+static_assert(sizeof(playerstore_record::username) > max_username_length);
+static_assert(sizeof(playerstore_record::hidden_word) > themecatalog::max_word_length);
+static_assert(sizeof(playerstore_record::hidden_word) > themecatalog::max_name_length);
+static_assert(sizeof(playerstore_record::attempts) > themecatalog::max_word_length + max_round_fails);
+static_assert(playerstore::theme_size > themecatalog::max_name_length);
+
+playerstore::playerstore() {
+    this->fd = -1;
+    memset(&this->header, 0, sizeof(this->header));
+}
+
+playerstore::~playerstore() {
+    close();
+}
+
+bool playerstore::fail(std::string message) {
+    this->last_error = message;
+    return false;
+}
+
+const std::string& playerstore::error() const {
+    return this->last_error;
+}
+
+size_t playerstore::size() const {
+    return this->header.record_count;
+}
+
+void playerstore::close() {
+#if !defined(_WIN32)
+    if (this->fd >= 0) {
+        ::close(this->fd);
+    }
+#endif
+    this->fd = -1;
+    this->themes.clear();
+    memset(&this->header, 0, sizeof(this->header));
+}
+
+#if defined(_WIN32)
+
+bool playerstore::open(std::string filename, bool truncate, bool read_only) {
+    return fail("O ficheiro binario de jogadores nao e suportado neste sistema");
+}
+
+bool playerstore::load(playertable& players) {
+    return fail("O ficheiro binario de jogadores nao e suportado neste sistema");
+}
+
+bool playerstore::write(player& target) {
+    return fail("O ficheiro binario de jogadores nao e suportado neste sistema");
+}
+
+bool playerstore::writeHeader() {
+    return false;
+}
+
+bool playerstore::writeTheme(uint16_t index) {
+    return false;
+}
+
+#else
+
+/*
+    Abrir (ou criar) o ficheiro binário e carregar o cabeçalho e a tabela de temas.
+    Com "truncate" o conteúdo existente é descartado. Com "read_only" o ficheiro tem de existir
+    e não pode ser alterado (ex. origem de uma conversão).
+*/
+bool playerstore::open(std::string filename, bool truncate, bool read_only) {
+    close();
+
+    if (read_only) {
+        this->fd = ::open(filename.c_str(), O_RDONLY);
+    } else {
+        this->fd = ::open(filename.c_str(), O_RDWR | O_CREAT | (truncate ? O_TRUNC : 0), 0644);
+    }
+    if (this->fd < 0) {
+        return fail("Nao foi possivel abrir o ficheiro \'" + filename + "\'");
+    }
+
+    struct stat info;
+    if (fstat(this->fd, &info) != 0) {
+        close();
+        return fail("Nao foi possivel ler o ficheiro \'" + filename + "\'");
+    }
+
+    // Ficheiro novo: escrever o cabeçalho e uma tabela de temas vazia.
+    if ((info.st_size == 0) && !read_only) {
+        memcpy(this->header.magic, playerstore_magic, sizeof(playerstore_magic));
+        this->header.version = version;
+        this->header.record_size = sizeof(playerstore_record);
+
+        std::string empty(records_offset, '\0');
+        if ((pwrite(this->fd, empty.data(), empty.size(), 0) != (ssize_t)empty.size()) || !writeHeader()) {
+            close();
+            return fail("Nao foi possivel escrever o ficheiro \'" + filename + "\'");
+        }
+        return true;
+    }
+
+    if ((info.st_size < (off_t)records_offset)
+        || (pread(this->fd, &this->header, sizeof(this->header), 0) != sizeof(this->header))
+        || (memcmp(this->header.magic, playerstore_magic, sizeof(playerstore_magic)) != 0)) {
+        close();
+        return fail("O ficheiro \'" + filename + "\' nao e um ficheiro de jogadores");
+    }
+
+    if ((this->header.version != version) || (this->header.record_size != sizeof(playerstore_record))) {
+        close();
+        return fail("O ficheiro \'" + filename + "\' tem uma versao nao suportada");
+    }
+
+    if ((this->header.theme_count > theme_capacity)
+        || (info.st_size < (off_t)(records_offset + (size_t)this->header.record_count * this->header.record_size))) {
+        close();
+        return fail("O ficheiro \'" + filename + "\' esta incompleto");
+    }
+
+    char theme[theme_size + 1] = {0};
+    for (uint32_t i = 0; i < this->header.theme_count; i++) {
+        if (pread(this->fd, theme, theme_size, header_size + i * theme_size) != theme_size) {
+            close();
+            return fail("O ficheiro \'" + filename + "\' esta incompleto");
+        }
+        this->themes.push_back(internString(theme));
+    }
+
+    return true;
+}
+
+/*
+    Mapear os registos em memória e convertê-los em jogadores.
+*/
+bool playerstore::load(playertable& players) {
+    if (this->fd < 0) {
+        return fail("O ficheiro de jogadores nao esta aberto");
+    }
+
+    size_t length = records_offset + (size_t)this->header.record_count * this->header.record_size;
+    void* address = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, this->fd, 0);
+    if (address == MAP_FAILED) {
+        return fail("Nao foi possivel mapear o ficheiro de jogadores");
+    }
+
+    const playerstore_record* records = (const playerstore_record*)((const char*)address + records_offset);
+    players.reserve(players.size() + this->header.record_count);
+
+    player loaded;
+    for (uint32_t i = 0; i < this->header.record_count; i++) {
+        decode(records[i], loaded);
+        loaded.store_index = i;
+        players.add(loaded);
+    }
+
+    munmap(address, length);
+    return true;
+}
+
+/*
+    Guardar um jogador no seu registo com uma única escrita. Um jogador sem registo é
+    acrescentado ao fim do ficheiro.
+*/
+bool playerstore::write(player& target) {
+    if (this->fd < 0) {
+        return fail("O ficheiro de jogadores nao esta aberto");
+    }
+
+    playerstore_record record;
+    if (!encode(target, record)) {
+        return false;
+    }
+
+    bool append = (target.store_index < 0);
+    uint32_t index = append ? this->header.record_count : target.store_index;
+
+    off_t offset = records_offset + (off_t)index * sizeof(playerstore_record);
+    if (pwrite(this->fd, &record, sizeof(record), offset) != sizeof(record)) {
+        return fail("Nao foi possivel escrever o registo de \'" + target.username + "\'");
+    }
+
+    if (append) {
+        this->header.record_count++;
+        if (!writeHeader()) {
+            this->header.record_count--;
+            return fail("Nao foi possivel escrever o registo de \'" + target.username + "\'");
+        }
+        target.store_index = index;
+    }
+
+    return true;
+}
+
+bool playerstore::writeHeader() {
+    return pwrite(this->fd, &this->header, sizeof(this->header), 0) == sizeof(this->header);
+}
+
+bool playerstore::writeTheme(uint16_t index) {
+    char theme[theme_size] = {0};
+    const std::string& name = getString(this->themes[index]);
+    memcpy(theme, name.data(), name.size());
+    return pwrite(this->fd, theme, theme_size, header_size + index * theme_size) == theme_size;
+}
+
+#endif
+
+/*
+    Obter o índice de um tema na tabela, acrescentando-o caso ainda não exista.
+    Um tema vazio é representado pelo índice 0xFFFF.
+*/
+bool playerstore::internTheme(string_id theme, uint16_t& index) {
+    if (theme == empty_string) {
+        index = 0xFFFF;
+        return true;
+    }
+
+    for (size_t i = 0; i < this->themes.size(); i++) {
+        if (this->themes[i] == theme) {
+            index = i;
+            return true;
+        }
+    }
+
+    const std::string& name = getString(theme);
+    if (name.size() >= theme_size) {
+        return fail("O tema \'" + name + "\' e demasiado longo");
+    } else if (this->themes.size() >= theme_capacity) {
+        return fail("A tabela de temas do ficheiro de jogadores esta cheia");
+    }
+
+    this->themes.push_back(theme);
+    index = this->themes.size() - 1;
+    this->header.theme_count = this->themes.size();
+
+    if (!writeTheme(index) || !writeHeader()) {
+        this->themes.pop_back();
+        this->header.theme_count = this->themes.size();
+        return fail("Nao foi possivel escrever o tema \'" + name + "\'");
+    }
+
+    return true;
+}
+
+// Copiar um texto para um campo de tamanho fixo, mantendo sempre o terminador.
+template <size_t length>
+static bool copyField(char (&field)[length], const std::string& value) {
+    if (value.size() >= length) {
+        return false;
+    }
+    memset(field, 0, length);
+    memcpy(field, value.data(), value.size());
+    return true;
+}
+
+template <size_t length>
+static std::string readField(const char (&field)[length]) {
+    return std::string(field, strnlen(field, length));
+}
+
+bool playerstore::encode(const player& source, playerstore_record& record) {
+    memset(&record, 0, sizeof(record));
+
+    if (!copyField(record.username, source.username)
+        || !copyField(record.hidden_word, source.hidden_word)
+        || !copyField(record.attempts, source.attempts)) {
+        return fail("Os dados de \'" + source.username + "\' nao cabem num registo");
+    }
+
+    if (!internTheme(source.theme_persistent, record.theme_persistent)) {
+        return false;
+    }
+
+    record.score_persistent = source.score_persistent;
+    record.rounds_persistent = source.rounds_persistent;
+    record.fails_persistent = source.fails_persistent;
+    record.time_persistent = source.time_persistent;
+    record.gamemode_persistent = source.gamemode_persistent;
+    record.difficulty_persistent = source.difficulty_persistent;
+    record.score_runtime = source.score_runtime;
+    record.time_runtime = source.time_runtime;
+    return true;
+}
+
+void playerstore::decode(const playerstore_record& record, player& target) {
+    target.username = readField(record.username);
+    target.score_persistent = record.score_persistent;
+    target.rounds_persistent = record.rounds_persistent;
+    target.fails_persistent = record.fails_persistent;
+    target.time_persistent = record.time_persistent;
+    target.gamemode_persistent = record.gamemode_persistent;
+    target.difficulty_persistent = record.difficulty_persistent;
+    target.theme_persistent = empty_string;
+    if (record.theme_persistent < this->themes.size()) {
+        target.theme_persistent = this->themes[record.theme_persistent];
+    }
+    target.score_runtime = record.score_runtime;
+    target.time_runtime = record.time_runtime;
+    target.hidden_word = readField(record.hidden_word);
+    target.attempts = readField(record.attempts);
+}
+
+/*
+    Diário de um ficheiro de jogadores em texto: "players.txt" tem o diário "players.journal".
+*/
+static std::string getJournalFilename(const std::string& filename) {
+    size_t extension = filename.rfind('.');
+    size_t directory = filename.find_last_of("/\\");
+    if ((extension == std::string::npos) || ((directory != std::string::npos) && (extension < directory))) {
+        return filename + ".journal";
+    }
+    return filename.substr(0, extension) + ".journal";
+}
+
+/*
+    Converter os jogadores entre o formato de texto ("players.txt") e o formato binário.
+    O sentido da conversão é determinado pela extensão ".bin" do ficheiro de destino.
+
+    A origem nunca é criada nem alterada: se não existir, a conversão falha sem tocar no
+    destino. As entradas pendentes do diário da origem em texto são aplicadas antes de
+    converter, e o diário do destino em texto é esvaziado, porque descreve o ficheiro substituído.
+*/
+bool convertPlayerData(std::string source, std::string destination) {
+    playertable players;
+    playerstore store;
+    player temp;
+
+    bool to_binary = (destination.size() > 4) && (destination.substr(destination.size() - 4) == ".bin");
+
+    if (to_binary) {
+        mappedfile file;
+        if (!file.open(source)) {
+            std::cout << "Erro: " << file.error() << "\n";
+            return false;
+        }
+
+        textparser data(file.view(), source);
+        int playerCount = 0;
+
+        bool valid = data.nextInt(playerCount, "numero de jogadores");
+        for (int i = 0; valid && (i < playerCount); i++) {
+            valid = temp.parseRawPlayerData(data);
+            players.add(temp);
+        }
+
+        if (!valid) {
+            std::cout << "Erro: " << data.error() << "\n";
+            return false;
+        }
+
+        std::string error;
+        bool read = readPlayerJournal(getJournalFilename(source), [&](const player& loaded) {
+            players.add(loaded);
+        }, error);
+
+        if (!read) {
+            std::cout << "Erro: " << error << "\n";
+            return false;
+        }
+
+        if (!store.open(destination, true)) {
+            std::cout << "Erro: " << store.error() << "\n";
+            return false;
+        }
+
+        for (player_handle handle = 0; handle < players.size(); handle++) {
+            players.get(handle, temp);
+            if (!store.write(temp)) {
+                std::cout << "Erro: " << store.error() << "\n";
+                return false;
+            }
+        }
+    } else {
+        if (!store.open(source, false, true) || !store.load(players)) {
+            std::cout << "Erro: " << store.error() << "\n";
+            return false;
+        }
+
+        std::stringstream data;
+        data << players.size() << "\n";
+        for (player_handle handle = 0; handle < players.size(); handle++) {
+            players.get(handle, temp);
+            temp.toRawPlayerData(data);
+        }
+        if (!replaceFileData(destination, data.str())) {
+            std::cout << "Erro: Nao foi possivel escrever o ficheiro \'" << destination << "\'\n";
+            return false;
+        }
+
+        std::string journal = getJournalFilename(destination);
+        if (hasFileData(journal) && !replaceFileData(journal, "")) {
+            std::cout << "Erro: Nao foi possivel escrever o ficheiro \'" << journal << "\'\n";
+            return false;
+        }
+    }
+
+    std::cout << players.size() << " jogadores convertidos de \'" << source << "\' para \'" << destination << "\'\n";
+    return true;
+}
@@ -0,0 +1,115 @@
+#include "playertable.hpp"
+
+/*
+    Acrescentar um jogador ao fim da tabela. Um jogador com um nome já existente substitui
+    os dados do anterior, mantendo a sua posição.
+*/
+player_handle playertable::add(const player& source) {
+    player_handle existing = find(source.username);
+    if (existing != invalid_player) {
+        set(existing, source);
+        return existing;
+    }
+
+    player_handle handle = this->details.size();
+
+    this->scores.push_back(0);
+    this->rounds.push_back(0);
+    this->fails.push_back(0);
+    this->times.push_back(0);
+    this->details.emplace_back();
+    this->details.back().handle = handle;
+
+    set(handle, source);
+    this->usernames.insert(&this->details.back());
+    return handle;
+}
+
+player_handle playertable::find(std::string_view username) const {
+    const player_details* found = this->usernames.find(username);
+    return (found == nullptr) ? invalid_player : found->handle;
+}
+
+void playertable::get(player_handle handle, player& target) const {
+    const player_details& source = this->details[handle];
+
+    target.username = source.username;
+    target.score_persistent = this->scores[handle];
+    target.rounds_persistent = this->rounds[handle];
+    target.fails_persistent = this->fails[handle];
+    target.time_persistent = this->times[handle];
+    target.gamemode_persistent = source.gamemode_persistent;
+    target.difficulty_persistent = source.difficulty_persistent;
+    target.theme_persistent = source.theme_persistent;
+    target.gamemode_runtime = source.gamemode_runtime;
+    target.difficulty_runtime = source.difficulty_runtime;
+    target.theme_runtime = source.theme_runtime;
+    target.score_runtime = source.score_runtime;
+    target.time_runtime = source.time_runtime;
+    target.hidden_word = source.hidden_word;
+    target.attempts = source.attempts;
+    target.store_index = source.store_index;
+}
+
+/*
+    Guardar os dados de "source" na posição "handle". O nome do jogador não é alterado.
+*/
+void playertable::set(player_handle handle, const player& source) {
+    player_details& target = this->details[handle];
+
+    if (target.username.empty()) {
+        target.username = source.username;
+    }
+    this->scores[handle] = source.score_persistent;
+    this->rounds[handle] = source.rounds_persistent;
+    this->fails[handle] = source.fails_persistent;
+    this->times[handle] = source.time_persistent;
+    target.gamemode_persistent = source.gamemode_persistent;
+    target.difficulty_persistent = source.difficulty_persistent;
+    target.theme_persistent = source.theme_persistent;
+    target.gamemode_runtime = source.gamemode_runtime;
+    target.difficulty_runtime = source.difficulty_runtime;
+    target.theme_runtime = source.theme_runtime;
+    target.score_runtime = source.score_runtime;
+    target.time_runtime = source.time_runtime;
+    target.hidden_word = source.hidden_word;
+    target.attempts = source.attempts;
+    target.store_index = source.store_index;
+}
+
+void playertable::setStoreIndex(player_handle handle, int store_index) {
+    this->details[handle].store_index = store_index;
+}
+
+const std::string& playertable::getUsername(player_handle handle) const {
+    return this->details[handle].username;
+}
+
+int playertable::getScore(player_handle handle) const {
+    return this->scores[handle];
+}
+
+int playertable::getStoreIndex(player_handle handle) const {
+    return this->details[handle].store_index;
+}
+
+void playertable::reserve(size_t capacity) {
+    this->scores.reserve(capacity);
+    this->rounds.reserve(capacity);
+    this->fails.reserve(capacity);
+    this->times.reserve(capacity);
+    this->usernames.reserve(capacity);
+}
+
+void playertable::clear() {
+    this->scores.clear();
+    this->rounds.clear();
+    this->fails.clear();
+    this->times.clear();
+    this->details.clear();
+    this->usernames.clear();
+}
+
+size_t playertable::size() const {
+    return this->details.size();
+}
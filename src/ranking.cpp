@@ -0,0 +1,235 @@
+#include "ranking.hpp"
+
+#include <algorithm>
+
+ranking::ranking() {
+    this->random_state = 0x9E3779B97F4A7C15ULL;
+    clear();
+}
+
+void ranking::clear() {
+    this->nodes.clear();
+    this->links.clear();
+    this->positions.clear();
+    this->levels = 1;
+    this->count = 0;
+
+    // O nó de cabeça tem todos os níveis e não pertence à tabela.
+    this->head = createNode("", 0, max_levels);
+}
+
+size_t ranking::size() const {
+    return this->count;
+}
+
+ranking::node* ranking::createNode(std::string username, int score, int level_count) {
+    this->nodes.push_back({std::move(username), score, this->nodes.size(), this->links.size(), level_count});
+    this->links.resize(this->links.size() + level_count, {nullptr, 0});
+    return &this->nodes.back();
+}
+
+ranking::link& ranking::linkAt(const node* target, int level) {
+    return this->links[target->first_link + level];
+}
+
+const ranking::link& ranking::linkAt(const node* target, int level) const {
+    return this->links[target->first_link + level];
+}
+
+/*
+    Cada nível acima do primeiro é atingido com probabilidade 1/4 (xorshift64, independente
+    do gerador utilizado pelo jogo, para não alterar a sequência das palavras sorteadas).
+*/
+int ranking::randomLevel() {
+    this->random_state ^= this->random_state << 13;
+    this->random_state ^= this->random_state >> 7;
+    this->random_state ^= this->random_state << 17;
+
+    uint64_t bits = this->random_state;
+    int level = 1;
+    while ((level < max_levels) && ((bits & 3) == 0)) {
+        level++;
+        bits >>= 2;
+    }
+    return level;
+}
+
+// Verificar se "n1" fica antes da posição de uma pontuação "score" inserida em "sequence".
+bool ranking::before(const node* n1, int score, uint64_t sequence) {
+    return (n1->score > score) || ((n1->score == score) && (n1->sequence < sequence));
+}
+
+void ranking::attach(node* target) {
+    node* update[max_levels];
+    size_t position[max_levels];
+
+    node* current = this->head;
+    for (int level = this->levels - 1; level >= 0; level--) {
+        position[level] = (level == this->levels - 1) ? 0 : position[level + 1];
+        while ((linkAt(current, level).next != nullptr) && before(linkAt(current, level).next, target->score, target->sequence)) {
+            position[level] += linkAt(current, level).span;
+            current = linkAt(current, level).next;
+        }
+        update[level] = current;
+    }
+
+    if (target->level_count > this->levels) {
+        for (int level = this->levels; level < target->level_count; level++) {
+            position[level] = 0;
+            update[level] = this->head;
+            linkAt(this->head, level).span = this->count;
+        }
+        this->levels = target->level_count;
+    }
+
+    for (int level = 0; level < target->level_count; level++) {
+        link& previous = linkAt(update[level], level);
+        linkAt(target, level).next = previous.next;
+        linkAt(target, level).span = previous.span - (position[0] - position[level]);
+        previous.next = target;
+        previous.span = (position[0] - position[level]) + 1;
+    }
+
+    for (int level = target->level_count; level < this->levels; level++) {
+        linkAt(update[level], level).span++;
+    }
+
+    this->count++;
+}
+
+void ranking::detach(node* target) {
+    node* current = this->head;
+    for (int level = this->levels - 1; level >= 0; level--) {
+        while ((linkAt(current, level).next != nullptr) && before(linkAt(current, level).next, target->score, target->sequence)) {
+            current = linkAt(current, level).next;
+        }
+
+        link& previous = linkAt(current, level);
+        if (previous.next == target) {
+            previous.span += linkAt(target, level).span - 1;
+            previous.next = linkAt(target, level).next;
+        } else {
+            previous.span--;
+        }
+    }
+
+    while ((this->levels > 1) && (linkAt(this->head, this->levels - 1).next == nullptr)) {
+        this->levels--;
+    }
+
+    this->count--;
+}
+
+/*
+    Substituir o conteúdo da tabela por "entries", ordenando-as uma única vez e ligando os
+    nós em tempo linear (mais rápido do que inserir os jogadores um a um ao carregar).
+    A ordem de "entries" decide os empates, tal como a ordem de inserção em "update".
+    Um nome repetido mantém apenas a primeira ocorrência por ordem de pontuação.
+*/
+void ranking::assign(std::vector<leaderboard_entry> entries) {
+    clear();
+
+    // Ordenar apenas pares (pontuação, posição), em vez de mover os nomes durante a ordenação.
+    std::vector<std::pair<int, size_t>> order(entries.size());
+    for (size_t i = 0; i < entries.size(); i++) {
+        order[i] = {-entries[i].score, i};
+    }
+    std::sort(order.begin(), order.end());
+
+    node* tail[max_levels];
+    size_t position[max_levels];
+    for (int level = 0; level < max_levels; level++) {
+        tail[level] = this->head;
+        position[level] = 0;
+    }
+
+    this->positions.reserve(entries.size());
+    this->links.reserve(entries.size() * 4 / 3 + max_levels);
+
+    for (std::pair<int, size_t>& ordered : order) {
+        leaderboard_entry& entry = entries[ordered.second];
+        if (this->positions.find(entry.username) != nullptr) {
+            continue;
+        }
+
+        node* target = createNode(std::move(entry.username), entry.score, randomLevel());
+        this->positions.insert(target);
+        this->count++;
+
+        this->levels = std::max(this->levels, target->level_count);
+        for (int level = 0; level < target->level_count; level++) {
+            linkAt(tail[level], level) = {target, this->count - position[level]};
+            tail[level] = target;
+            position[level] = this->count;
+        }
+    }
+
+    for (int level = 0; level < this->levels; level++) {
+        linkAt(tail[level], level).span = this->count - position[level];
+    }
+}
+
+/*
+    Inserir um jogador, ou atualizar a sua posição caso a pontuação tenha mudado.
+*/
+void ranking::update(const std::string& username, int score) {
+    node* target = this->positions.find(username);
+    if (target != nullptr) {
+        if (target->score != score) {
+            detach(target);
+            target->score = score;
+            attach(target);
+        }
+        return;
+    }
+
+    target = createNode(username, score, randomLevel());
+    this->positions.insert(target);
+    attach(target);
+}
+
+/*
+    Obter "length" posições da tabela a partir da posição "start" (a primeira posição é 0).
+*/
+std::vector<leaderboard_entry> ranking::page(size_t start, size_t length) const {
+    std::vector<leaderboard_entry> entries;
+    if (start >= this->count) {
+        return entries;
+    }
+
+    // Avançar até à posição "start" (o nó de cabeça ocupa a posição 0 dos percursos).
+    const node* current = this->head;
+    size_t position = 0;
+    for (int level = this->levels - 1; level >= 0; level--) {
+        while ((linkAt(current, level).next != nullptr) && (position + linkAt(current, level).span <= start + 1)) {
+            position += linkAt(current, level).span;
+            current = linkAt(current, level).next;
+        }
+    }
+
+    for (size_t i = 0; (current != nullptr) && (i < length); i++) {
+        entries.push_back({current->username, current->score});
+        current = linkAt(current, 0).next;
+    }
+    return entries;
+}
+
+/*
+    Obter a posição de um jogador na tabela (a primeira posição é 0), ou -1 se não existir.
+*/
+long ranking::rank(const std::string& username) const {
+    const node* target = this->positions.find(username);
+    if (target == nullptr) {
+        return -1;
+    }
+
+    const node* current = this->head;
+    size_t position = 0;
+    for (int level = this->levels - 1; level >= 0; level--) {
+        while ((linkAt(current, level).next != nullptr) && before(linkAt(current, level).next, target->score, target->sequence)) {
+            position += linkAt(current, level).span;
+            current = linkAt(current, level).next;
+        }
+    }
+    return position;
+}
@@ -0,0 +1,80 @@
+#include "replay.hpp"
+
+#include <filesystem>
+
+#include <unistd.h>
+
+// Ficheiros de dados do jogo copiados para o diretório temporário da reprodução.
+static const char* replay_files[] = {"players.txt", "players.journal", "players.idx", "players.bin", "themes.txt"};
+
+/*
+    Reproduzir uma sessão gravada "sessions" vezes, o mais depressa possível, sem output e
+    sem animações. Cada sessão cria um novo jogo, pelo que inclui o carregamento e a
+    gravação dos dados dos jogadores e dos temas.
+
+    As sessões são reproduzidas num diretório temporário, com cópias dos ficheiros de dados do
+    diretório atual, que nunca são alterados. O diretório é removido no fim.
+*/
+int runReplay(game_options options, std::string session_filename, int sessions) {
+    std::vector<std::string> tokens;
+    if (!loadSessionFile(session_filename, tokens)) {
+        return -1;
+    }
+
+    options.selection_delay = 0;
+    options.null_output = true;
+
+    std::error_code error;
+    std::filesystem::path original = std::filesystem::current_path(error);
+    if (options.images_filename != "") {
+        options.images_filename = std::filesystem::absolute(options.images_filename, error).string();
+    }
+
+    std::string pattern = (std::filesystem::temp_directory_path(error) / "hangman-replay-XXXXXX").string();
+    if ((mkdtemp(&pattern[0]) == nullptr)) {
+        std::cout << "Erro: Nao foi possivel criar o diretorio temporario\n";
+        return -1;
+    }
+    std::filesystem::path directory = pattern;
+
+    for (const char* filename : replay_files) {
+        if (std::filesystem::exists(original / filename, error)
+            && !std::filesystem::copy_file(original / filename, directory / filename, error)) {
+            std::cout << "Erro: Nao foi possivel copiar o ficheiro \'" << filename << "\'\n";
+            std::filesystem::remove_all(directory, error);
+            return -1;
+        }
+    }
+
+    std::filesystem::current_path(directory, error);
+    if (error) {
+        std::cout << "Erro: Nao foi possivel utilizar o diretorio \'" << directory.string() << "\'\n";
+        std::filesystem::remove_all(directory, error);
+        return -1;
+    }
+
+    std::chrono::time_point<std::chrono::steady_clock> clock_start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < sessions; i++) {
+        script_input session(tokens);
+        options.input = &session;
+
+        game replay_game = game(options);
+        replay_game.run();
+    }
+
+    std::chrono::time_point<std::chrono::steady_clock> clock_end = std::chrono::steady_clock::now();
+    std::chrono::duration<double> difference = (clock_end - clock_start);
+    double duration = difference.count();
+
+    std::filesystem::current_path(original, error);
+    std::filesystem::remove_all(directory, error);
+
+    std::cout << "Sessoes: " << sessions << "\n"
+        << "Tokens por sessao: " << tokens.size() << "\n"
+        << "Tempo total: " << duration << " s\n"
+        << "Sessoes por segundo: " << (duration > 0 ? sessions / duration : 0) << "\n"
+        << "Tempo por sessao: " << (sessions > 0 ? duration * 1e6 / sessions : 0) << " us\n";
+
+    return 0;
+}
@@ -0,0 +1,132 @@
+#include "roundstate.hpp"
+
+roundstate::roundstate() {
+    start("");
+}
+
+void roundstate::start(const std::string& __word) {
+    start(__word, describeWord(__word));
+}
+
+/*
+    Começar uma ronda com a palavra "__word", cujas letras já são conhecidas, agrupando as
+    posições de cada letra por contagem (duas passagens pela palavra).
+*/
+void roundstate::start(const std::string& __word, const word_metadata& metadata) {
+    this->word = __word;
+    this->pattern.assign(this->word.size(), '\0');
+    this->display.assign(this->word.size() * 2, ' ');
+    for (size_t i = 0; i < this->word.size(); i++) {
+        this->display[i * 2] = '_';
+    }
+    this->failed.clear();
+
+    this->letters = metadata.letters;
+    this->guessed.reset();
+    this->correct.reset();
+    this->missing.reset();
+    this->fails = 0;
+
+    this->first.fill(0);
+    for (char letter : this->word) {
+        this->first[(unsigned char)letter + 1]++;
+    }
+    for (size_t i = 1; i < this->first.size(); i++) {
+        this->first[i] += this->first[i - 1];
+    }
+
+    std::array<uint32_t, 256> next;
+    std::copy(this->first.begin(), this->first.end() - 1, next.begin());
+    this->positions.resize(this->word.size());
+    for (size_t i = 0; i < this->word.size(); i++) {
+        this->positions[next[(unsigned char)this->word[i]]++] = i;
+    }
+}
+
+/*
+    Repetir as tentativas já feitas (ex. ao retomar uma ronda guardada).
+*/
+void roundstate::replay(const std::string& attempts) {
+    for (char letter : attempts) {
+        guess(letter);
+    }
+}
+
+/*
+    Tentar a letra "letter". Uma letra já tentada não é contada de novo.
+    Uma resposta vazia ('\0') conta sempre como falha sem ficar registada, tal como não fica
+    registada nas tentativas guardadas do jogador.
+*/
+guess_result roundstate::guess(char letter) {
+    unsigned char index = letter;
+
+    if (this->guessed.test(index)) {
+        return GUESS_REPEATED;
+    }
+
+    if (!this->letters.test(index)) {
+        this->fails++;
+        if (index != '\0') {
+            this->guessed.set(index);
+            this->missing.set(index);
+            this->failed += letter;
+        }
+        return GUESS_MISSING;
+    }
+
+    this->guessed.set(index);
+    this->correct.set(index);
+    for (uint32_t i = this->first[index]; i < this->first[index + 1]; i++) {
+        this->pattern[this->positions[i]] = letter;
+        this->display[this->positions[i] * 2] = letter;
+    }
+    return GUESS_CORRECT;
+}
+
+const std::string& roundstate::getWord() const {
+    return this->word;
+}
+
+const std::string& roundstate::getPattern() const {
+    return this->pattern;
+}
+
+const std::string& roundstate::getDisplay() const {
+    return this->display;
+}
+
+const std::string& roundstate::getFailed() const {
+    return this->failed;
+}
+
+int roundstate::getUnique() const {
+    return this->letters.count();
+}
+
+int roundstate::getCorrect() const {
+    return this->correct.count();
+}
+
+int roundstate::getFails() const {
+    return this->fails;
+}
+
+bool roundstate::isSolved() const {
+    return this->correct == this->letters;
+}
+
+const letter_set& roundstate::getCorrectLetters() const {
+    return this->correct;
+}
+
+const letter_set& roundstate::getMissingLetters() const {
+    return this->missing;
+}
+
+bool roundstate::hasLetter(char letter) const {
+    return this->letters.test((unsigned char)letter);
+}
+
+bool roundstate::wasGuessed(char letter) const {
+    return this->guessed.test((unsigned char)letter);
+}
@@ -0,0 +1,155 @@
+#include "screen.hpp"
+
+#include <algorithm>
+#include <cerrno>
+
+// Número de carateres iguais a partir do qual compensa reposicionar o cursor em vez de os reescrever.
+static const int cursor_move_cost = 8;
+
+screen::screen() {
+    this->front.assign(width * height, '\0');
+    this->back.assign(width * height, ' ');
+    this->front_valid = false;
+    this->output_enabled = true;
+    this->cursor_x = 1;
+    this->cursor_y = 1;
+
+#if defined(_WIN32)
+    HANDLE handle = GetStdHandle(STD_OUTPUT_HANDLE);
+    DWORD mode = 0;
+    if (GetConsoleMode(handle, &mode)) {
+        SetConsoleMode(handle, mode | ENABLE_VIRTUAL_TERMINAL_PROCESSING);
+    }
+#endif
+}
+
+screen::~screen() {
+
+}
+
+/*
+    Copiar uma imagem do atlas (linhas de 72 carateres terminadas por '\n') para o "back" buffer.
+*/
+void screen::load(std::string_view frame) {
+    this->back.assign(width * height, ' ');
+
+    for (int row = 0; row < height; row++) {
+        size_t offset = (size_t)row * atlas::image_width;
+        if (offset >= frame.size()) {
+            break;
+        }
+
+        std::string_view line = frame.substr(offset, width);
+        size_t end = line.find('\n');
+        if (end != std::string_view::npos) {
+            line = line.substr(0, end);
+        }
+        this->back.replace(row * width, line.size(), line);
+    }
+}
+
+/*
+    Escrever texto na posição (x, y), com origem em (1, 1). O texto que ultrapasse a
+    largura do ecrã é descartado.
+*/
+void screen::stamp(int x, int y, std::string_view text) {
+    if ((y < 1) || (y > height)) {
+        return;
+    }
+
+    for (char c : text) {
+        if ((x >= 1) && (x <= width)) {
+            this->back[(y - 1) * width + (x - 1)] = c;
+        }
+        x++;
+    }
+}
+
+/*
+    Marcar as linhas a partir da posição do cursor como desconhecidas, por exemplo depois
+    de o terminal ter ecoado o texto introduzido pelo utilizador.
+*/
+void screen::invalidate() {
+    int y = std::max(this->cursor_y, 1);
+
+    for (int row = y - 1; row < height; row++) {
+        this->front.replace(row * width, width, width, '\0');
+    }
+}
+
+/*
+    Com o output desativado as imagens continuam a ser compostas, mas nada é escrito.
+*/
+void screen::setOutputEnabled(bool enabled) {
+    this->output_enabled = enabled;
+}
+
+/*
+    Enviar para o terminal apenas os segmentos de cada linha que diferem do que já lá está
+    e terminar com o cursor na posição (x, y). Todo o ecrã é enviado numa única escrita.
+*/
+void screen::commit(int x, int y) {
+    std::string output;
+
+    this->cursor_x = x;
+    this->cursor_y = y;
+
+    if (!this->front_valid) {
+        output += "\x1B[H\x1B[2J";
+        this->front_valid = true;
+    }
+
+    for (int row = 0; row < height; row++) {
+        int column = 0;
+        while (column < width) {
+            int index = row * width + column;
+            if (this->front[index] == this->back[index]) {
+                column++;
+                continue;
+            }
+
+            // Estender o segmento enquanto as diferenças estiverem próximas.
+            int start = column;
+            int end = column + 1;
+            int equal = 0;
+            for (int i = end; (i < width) && (equal < cursor_move_cost); i++) {
+                if (this->front[row * width + i] == this->back[row * width + i]) {
+                    equal++;
+                } else {
+                    equal = 0;
+                    end = i + 1;
+                }
+            }
+
+            output += "\x1B[" + std::to_string(row + 1) + ";" + std::to_string(start + 1) + "H";
+            output.append(this->back, row * width + start, end - start);
+            this->front.replace(row * width + start, end - start, this->back, row * width + start, end - start);
+
+            column = end;
+        }
+    }
+
+    output += "\x1B[" + std::to_string(this->cursor_y) + ";" + std::to_string(this->cursor_x) + "H";
+
+    if (!this->output_enabled) {
+        return;
+    }
+
+    // Garantir que nada do que foi escrito através de std::cout fica para trás.
+    std::cout.flush();
+
+    size_t written = 0;
+    while (written < output.size()) {
+    #if defined(_WIN32)
+        int result = _write(1, output.data() + written, output.size() - written);
+    #else
+        ssize_t result = ::write(STDOUT_FILENO, output.data() + written, output.size() - written);
+    #endif
+        if ((result < 0) && (errno == EINTR)) {
+            continue;
+        } else if (result <= 0) {
+            break;
+        }
+        written += result;
+    }
+}
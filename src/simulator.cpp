@@ -0,0 +1,265 @@
+#include "simulator.hpp"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+#include "game.hpp"
+
+// Tempo (s) que o jogador simulado demora em cada tentativa.
+static const float sim_min_duration = 1;
+static const float sim_max_duration = 8;
+
+static const char* difficulty_names[] = {"Facil", "Medio", "Dificil"};
+
+/*
+    Preparar os temas do catálogo: as palavras e as suas propriedades, para não consultar o
+    "stringpool" durante a simulação, e o índice do "solver" de cada tema (construídos em
+    paralelo, um tema por tarefa).
+*/
+void simulator::build(themecatalog& catalog, workpool& pool) {
+    this->initial.assign(catalog.begin(), catalog.end());
+    this->themes.clear();
+    this->themes.resize(this->initial.size());
+
+    for (size_t i = 0; i < this->initial.size(); i++) {
+        sim_theme& theme = this->themes[i];
+        theme.name = &getString(this->initial[i].name);
+        for (const word_info& word : this->initial[i].words) {
+            theme.texts.push_back(&getString(word.word));
+            theme.metadata.push_back(catalog.describe(word.word));
+        }
+    }
+
+    pool.run(this->themes.size(), [&](size_t, size_t theme) {
+        this->themes[theme].hints.build(this->initial[theme]);
+    });
+}
+
+size_t simulator::size() const {
+    return this->themes.size();
+}
+
+const std::string& simulator::getThemeName(size_t theme) const {
+    return *this->themes[theme].name;
+}
+
+/*
+    Jogar uma ronda: a palavra é sorteada como em "selectRandomWord" (um tema vazio utiliza o
+    próprio nome) e cada tentativa é pontuada como em "roundActor", até à última falha.
+*/
+void simulator::playRound(sim_worker& worker, const sim_options& options) const {
+    xoshiro256& generator = worker.generator;
+    size_t index = generator.bounded(this->themes.size());
+    int difficulty = randi(generator, DIFFICULTY_EASY, DIFFICULTY_HARD);
+    const sim_theme& theme = this->themes[index];
+    theme_info& theme_data = worker.themes[index];
+    sim_theme_stats& theme_stats = worker.stats[index];
+    roundstate& round = worker.round;
+
+    if (theme_data.words.empty()) {
+        round.start(*theme.name);
+    } else {
+        // O valor sorteado inclui o total, tal como em "selectRandomWord".
+        long long threshold = generator.bounded(theme_data.sampler.total() + 1);
+        if (threshold >= theme_data.sampler.total()) {
+            theme_stats.resets++;
+        }
+
+        size_t word = themecatalog::drawWord(theme_data, threshold);
+        theme_stats.draws[word]++;
+        round.start(*theme.texts[word], theme.metadata[word]);
+    }
+
+    int multiplier = getDifficultyMultiplier(difficulty);
+    int score = 0;
+    int time = 0;
+    long long guesses = 0;
+
+    while ((round.getFails() < max_round_fails) && !round.isSolved()) {
+        char letter = '\0';
+        if ((int)generator.bounded(100) < options.skill) {
+            letter = theme.hints.suggest(round.getPattern(), round.getCorrectLetters(), round.getMissingLetters());
+        }
+
+        // Letra ao acaso entre as ainda não tentadas; sem nenhuma, a resposta vazia conta como falha.
+        if (letter == '\0') {
+            int available = 0;
+            for (char candidate = 'a'; candidate <= 'z'; candidate++) {
+                available += !round.wasGuessed(candidate);
+            }
+            if (available > 0) {
+                int pick = generator.bounded(available);
+                for (char candidate = 'a'; candidate <= 'z'; candidate++) {
+                    if (!round.wasGuessed(candidate) && (pick-- == 0)) {
+                        letter = candidate;
+                        break;
+                    }
+                }
+            }
+        }
+
+        float duration = map(generator.real(), 0, 1, sim_min_duration, sim_max_duration);
+        round.guess(letter);
+        guesses++;
+
+        time += duration;
+        score = getRoundScore(round.getCorrect(), duration, multiplier);
+    }
+
+    sim_totals& totals = theme_stats.difficulties[difficulty];
+    totals.rounds++;
+    totals.wins += round.isSolved();
+    totals.score += score;
+    totals.fails += round.getFails();
+    totals.guesses += guesses;
+    totals.time += time;
+}
+
+/*
+    Jogar as rondas da sessão "session" a partir das ocorrências iniciais das palavras, com a
+    sequência do gerador dada pela semente e pelo número da sessão.
+*/
+void simulator::playSession(sim_worker& worker, const sim_options& options, size_t session, int rounds) const {
+    worker.generator.seed(options.seed, session);
+
+    for (size_t i = 0; i < this->initial.size(); i++) {
+        worker.themes[i].words = this->initial[i].words;
+        worker.themes[i].sampler = this->initial[i].sampler;
+    }
+
+    for (int i = 0; i < rounds; i++) {
+        playRound(worker, options);
+    }
+}
+
+/*
+    Simular "options.rounds" rondas, juntando em "stats" as estatísticas de cada tema.
+*/
+void simulator::run(const sim_options& options, workpool& pool, std::vector<sim_theme_stats>& stats) const {
+    stats.assign(this->themes.size(), sim_theme_stats());
+    for (size_t i = 0; i < this->themes.size(); i++) {
+        stats[i].draws.assign(this->themes[i].texts.size(), 0);
+    }
+
+    if (this->themes.empty() || (options.rounds <= 0)) {
+        return;
+    }
+
+    std::vector<std::unique_ptr<sim_worker>> workers;
+    for (size_t i = 0; i < pool.size(); i++) {
+        workers.push_back(std::make_unique<sim_worker>());
+        workers.back()->themes = this->initial;
+        workers.back()->stats = stats;
+    }
+
+    long long sessions = std::max(options.sessions, 1);
+    pool.run(sessions, [&](size_t worker, size_t session) {
+        int rounds = (long long)options.rounds * (session + 1) / sessions - (long long)options.rounds * session / sessions;
+        playSession(*workers[worker], options, session, rounds);
+    });
+
+    for (const std::unique_ptr<sim_worker>& worker : workers) {
+        for (size_t i = 0; i < stats.size(); i++) {
+            const sim_theme_stats& source = worker->stats[i];
+            for (size_t difficulty = 0; difficulty < stats[i].difficulties.size(); difficulty++) {
+                sim_totals& totals = stats[i].difficulties[difficulty];
+                const sim_totals& partial = source.difficulties[difficulty];
+                totals.rounds += partial.rounds;
+                totals.wins += partial.wins;
+                totals.score += partial.score;
+                totals.fails += partial.fails;
+                totals.guesses += partial.guesses;
+                totals.time += partial.time;
+            }
+            for (size_t word = 0; word < stats[i].draws.size(); word++) {
+                stats[i].draws[word] += source.draws[word];
+            }
+            stats[i].resets += source.resets;
+        }
+    }
+}
+
+static void printTotals(const std::string& label, const sim_totals& totals) {
+    double rounds = std::max(totals.rounds, 1LL);
+    std::cout << "  " << std::left << std::setw(10) << label << std::right
+        << std::setw(12) << totals.rounds
+        << std::setw(10) << std::fixed << std::setprecision(1) << totals.wins * 100.0 / rounds << "%"
+        << std::setw(12) << std::setprecision(2) << totals.score / rounds
+        << std::setw(10) << totals.fails / rounds
+        << std::setw(12) << totals.guesses / rounds
+        << std::setw(10) << totals.time / rounds << "\n";
+}
+
+/*
+    Simular as rondas com os temas de "themes.txt" (ou os temas embutidos) e escrever os
+    resultados de cada tema e dificuldade, e a distribuição do sorteio das palavras.
+*/
+int runSimulation(sim_options options) {
+    themecatalog catalog;
+    std::string error;
+    if (!loadThemeCatalog(catalog, error)) {
+        std::cout << "Erro: " << error << "\n";
+        return -1;
+    }
+
+    if (catalog.size() == 0) {
+        std::cout << "Erro: Nao existem temas para simular\n";
+        return -1;
+    }
+
+    workpool pool(options.threads);
+    simulator simulation;
+    simulation.build(catalog, pool);
+
+    std::chrono::time_point<std::chrono::steady_clock> clock_start = std::chrono::steady_clock::now();
+
+    std::vector<sim_theme_stats> stats;
+    simulation.run(options, pool, stats);
+
+    std::chrono::time_point<std::chrono::steady_clock> clock_end = std::chrono::steady_clock::now();
+    std::chrono::duration<double> difference = (clock_end - clock_start);
+    double duration = difference.count();
+
+    std::cout << "Rondas: " << options.rounds << "\n"
+        << "Threads: " << pool.size() << "\n"
+        << "Sessoes: " << std::max(options.sessions, 1) << " (ocorrencias acumuladas em cada sessao, a partir de themes.txt)\n"
+        << "Semente: " << options.seed << "\n"
+        << "Tempo total: " << duration << " s\n"
+        << "Rondas por segundo: " << (duration > 0 ? options.rounds / duration : 0) << "\n";
+
+    std::array<sim_totals, 3> overall = {};
+    for (size_t i = 0; i < stats.size(); i++) {
+        std::cout << "\nTema: " << simulation.getThemeName(i) << "\n";
+        std::cout << "  " << std::left << std::setw(10) << "" << std::right
+            << std::setw(12) << "Rondas" << std::setw(11) << "Vitorias"
+            << std::setw(12) << "Pontuacao" << std::setw(10) << "Falhas"
+            << std::setw(12) << "Tentativas" << std::setw(10) << "Tempo" << "\n";
+
+        for (size_t difficulty = 0; difficulty < overall.size(); difficulty++) {
+            const sim_totals& totals = stats[i].difficulties[difficulty];
+            printTotals(difficulty_names[difficulty], totals);
+
+            overall[difficulty].rounds += totals.rounds;
+            overall[difficulty].wins += totals.wins;
+            overall[difficulty].score += totals.score;
+            overall[difficulty].fails += totals.fails;
+            overall[difficulty].guesses += totals.guesses;
+            overall[difficulty].time += totals.time;
+        }
+
+        const std::vector<long long>& draws = stats[i].draws;
+        if (!draws.empty()) {
+            std::cout << "  Sorteios por palavra: min " << *std::min_element(draws.begin(), draws.end())
+                << ", max " << *std::max_element(draws.begin(), draws.end())
+                << ", reposicoes " << stats[i].resets << "\n";
+        }
+    }
+
+    std::cout << "\nTotal\n";
+    for (size_t difficulty = 0; difficulty < overall.size(); difficulty++) {
+        printTotals(difficulty_names[difficulty], overall[difficulty]);
+    }
+
+    return 0;
+}
@@ -0,0 +1,289 @@
+#include "solver.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+static const size_t block_bits = 64;
+
+static size_t getBlockCount(size_t words) {
+    return (words + block_bits - 1) / block_bits;
+}
+
+static const uint64_t* getBits(const std::vector<uint64_t>& bits, uint32_t set, size_t blocks) {
+    return bits.data() + (size_t)set * blocks;
+}
+
+/*
+    Construir o índice das palavras do tema. A primeira sugestão de cada tamanho não depende
+    da ronda, pelo que é calculada aqui uma única vez.
+*/
+void solver::build(const theme_info& theme) {
+    clear();
+
+    for (const word_info& word : theme.words) {
+        const std::string& text = getString(word.word);
+        if (text.empty() || (text.size() > max_length)) {
+            continue;
+        }
+
+        if (text.size() >= this->groups.size()) {
+            this->groups.resize(text.size() + 1);
+        }
+        this->groups[text.size()].words.push_back(text);
+        this->count++;
+    }
+
+    for (size_t length = 1; length < this->groups.size(); length++) {
+        length_group& group = this->groups[length];
+        size_t words = group.words.size();
+        group.blocks = getBlockCount(words);
+
+        // Atribuir um conjunto a cada par (posição, letra) e a cada letra que existam no grupo.
+        uint32_t sets = 0;
+        group.at.assign(length * 256, no_bits);
+        group.contains.assign(256, no_bits);
+        for (std::string_view text : group.words) {
+            for (size_t position = 0; position < length; position++) {
+                unsigned char letter = text[position];
+                if (group.at[position * 256 + letter] == no_bits) {
+                    group.at[position * 256 + letter] = sets++;
+                }
+                if (group.contains[letter] == no_bits) {
+                    group.contains[letter] = sets++;
+                }
+            }
+        }
+
+        group.bits.assign((size_t)sets * group.blocks, 0);
+        for (size_t i = 0; i < words; i++) {
+            std::string_view text = group.words[i];
+            uint64_t bit = (uint64_t)1 << (i % block_bits);
+            for (size_t position = 0; position < length; position++) {
+                unsigned char letter = text[position];
+                group.bits[(size_t)group.at[position * 256 + letter] * group.blocks + i / block_bits] |= bit;
+                group.bits[(size_t)group.contains[letter] * group.blocks + i / block_bits] |= bit;
+            }
+        }
+
+        word_bits all(group.blocks, ~(uint64_t)0);
+        if (words % block_bits != 0) {
+            all.back() = ((uint64_t)1 << (words % block_bits)) - 1;
+        }
+        group.opening = choose(group, all, words, letter_set());
+    }
+}
+
+void solver::clear() {
+    this->groups.clear();
+    this->count = 0;
+}
+
+size_t solver::size() const {
+    return this->count;
+}
+
+/*
+    Marcar em "candidates" as palavras do grupo compatíveis com a palavra revelada ("pattern",
+    com '\0' nas posições por revelar): têm as letras reveladas nas suas posições, nenhuma letra
+    certa numa posição por revelar (teria sido revelada), e nenhuma letra errada.
+*/
+size_t solver::filter(const length_group& group, std::string_view pattern,
+    const letter_set& correct, const letter_set& missing, word_bits& candidates) const {
+
+    size_t words = group.words.size();
+    candidates.assign(group.blocks, ~(uint64_t)0);
+    if (words % block_bits != 0) {
+        candidates.back() = ((uint64_t)1 << (words % block_bits)) - 1;
+    }
+
+    std::vector<unsigned char> correct_letters;
+    std::vector<unsigned char> missing_letters;
+    for (int letter = 0; letter < 256; letter++) {
+        if (correct.test(letter)) {
+            correct_letters.push_back(letter);
+        }
+        if (missing.test(letter)) {
+            missing_letters.push_back(letter);
+        }
+    }
+
+    for (size_t position = 0; position < pattern.size(); position++) {
+        unsigned char revealed = pattern[position];
+
+        if (revealed != '\0') {
+            uint32_t set = group.at[position * 256 + revealed];
+            if (set == no_bits) {
+                return 0;
+            }
+            const uint64_t* bits = getBits(group.bits, set, group.blocks);
+            for (size_t block = 0; block < group.blocks; block++) {
+                candidates[block] &= bits[block];
+            }
+            continue;
+        }
+
+        for (unsigned char letter : correct_letters) {
+            uint32_t set = group.at[position * 256 + letter];
+            if (set == no_bits) {
+                continue;
+            }
+            const uint64_t* bits = getBits(group.bits, set, group.blocks);
+            for (size_t block = 0; block < group.blocks; block++) {
+                candidates[block] &= ~bits[block];
+            }
+        }
+    }
+
+    for (unsigned char letter : missing_letters) {
+        uint32_t set = group.contains[letter];
+        if (set == no_bits) {
+            continue;
+        }
+        const uint64_t* bits = getBits(group.bits, set, group.blocks);
+        for (size_t block = 0; block < group.blocks; block++) {
+            candidates[block] &= ~bits[block];
+        }
+    }
+
+    size_t remaining = 0;
+    for (uint64_t block : candidates) {
+        remaining += __builtin_popcountll(block);
+    }
+    return remaining;
+}
+
+/*
+    Escolher, entre as letras ainda não tentadas, a que maximiza a entropia da revelação: as
+    palavras possíveis são agrupadas pelas posições onde a letra aparece (um grupo por cada
+    máscara de posições, mais o grupo das palavras sem a letra).
+
+    As máscaras são distribuídas por letra (ordenação por contagem) e ordenadas dentro de cada
+    letra para contar os grupos. Em caso de empate é preferida a letra presente em mais
+    palavras, e depois a de menor código.
+*/
+char solver::choose(const length_group& group, const word_bits& candidates, size_t candidate_count,
+    const letter_set& guessed) const {
+
+    if (candidate_count == 0) {
+        return '\0';
+    }
+
+    std::array<size_t, 257> offsets = {0};
+    std::array<uint64_t, 256> masks = {0};
+
+    auto forEachCandidate = [&](auto function) {
+        for (size_t block = 0; block < candidates.size(); block++) {
+            uint64_t bits = candidates[block];
+            while (bits != 0) {
+                function(block * block_bits + __builtin_ctzll(bits));
+                bits &= bits - 1;
+            }
+        }
+    };
+
+    // Máscara das posições de cada letra não tentada de uma palavra; chama "function" por letra.
+    auto forEachLetter = [&](size_t index, auto function) {
+        std::string_view text = group.words[index];
+        for (size_t position = 0; position < text.size(); position++) {
+            masks[(unsigned char)text[position]] |= (uint64_t)1 << position;
+        }
+        for (size_t position = 0; position < text.size(); position++) {
+            unsigned char letter = text[position];
+            if (masks[letter] != 0) {
+                if (!guessed.test(letter)) {
+                    function(letter, masks[letter]);
+                }
+                masks[letter] = 0;
+            }
+        }
+    };
+
+    forEachCandidate([&](size_t index) {
+        forEachLetter(index, [&](unsigned char letter, uint64_t) {
+            offsets[letter + 1]++;
+        });
+    });
+
+    for (size_t letter = 1; letter < offsets.size(); letter++) {
+        offsets[letter] += offsets[letter - 1];
+    }
+
+    std::vector<uint64_t> keys(offsets[256]);
+    std::array<size_t, 256> next;
+    std::copy(offsets.begin(), offsets.end() - 1, next.begin());
+
+    forEachCandidate([&](size_t index) {
+        forEachLetter(index, [&](unsigned char letter, uint64_t mask) {
+            keys[next[letter]++] = mask;
+        });
+    });
+
+    double total = candidate_count;
+    double best_entropy = -1;
+    size_t best_present = 0;
+    char best = '\0';
+
+    for (int letter = 0; letter < 256; letter++) {
+        size_t present = offsets[letter + 1] - offsets[letter];
+        if (present == 0) {
+            continue;
+        }
+
+        auto begin = keys.begin() + offsets[letter];
+        auto end = keys.begin() + offsets[letter + 1];
+        std::sort(begin, end);
+
+        double sum = 0;
+        size_t absent = candidate_count - present;
+        if (absent > 0) {
+            sum += absent * std::log2((double)absent);
+        }
+        for (auto run = begin; run != end;) {
+            auto run_end = std::upper_bound(run, end, *run);
+            double size = run_end - run;
+            sum += size * std::log2(size);
+            run = run_end;
+        }
+
+        double entropy = std::log2(total) - sum / total;
+        if ((entropy > best_entropy + 1e-12)
+            || ((std::fabs(entropy - best_entropy) <= 1e-12) && (present > best_present))) {
+            best_entropy = entropy;
+            best_present = present;
+            best = letter;
+        }
+    }
+
+    return best;
+}
+
+/*
+    Número de palavras do tema compatíveis com o estado da ronda.
+*/
+size_t solver::candidates(std::string_view pattern, const letter_set& correct, const letter_set& missing) const {
+    if ((pattern.size() >= this->groups.size()) || this->groups[pattern.size()].words.empty()) {
+        return 0;
+    }
+
+    word_bits candidates;
+    return filter(this->groups[pattern.size()], pattern, correct, missing, candidates);
+}
+
+/*
+    Sugerir a próxima letra a tentar, ou '\0' se nenhuma palavra do tema for compatível.
+*/
+char solver::suggest(std::string_view pattern, const letter_set& correct, const letter_set& missing) const {
+    if ((pattern.size() >= this->groups.size()) || this->groups[pattern.size()].words.empty()) {
+        return '\0';
+    }
+
+    const length_group& group = this->groups[pattern.size()];
+    if (correct.none() && missing.none()) {
+        return group.opening;
+    }
+
+    word_bits candidates;
+    size_t candidate_count = filter(group, pattern, correct, missing, candidates);
+    return choose(group, candidates, candidate_count, correct | missing);
+}
@@ -0,0 +1,61 @@
+#include "stringpool.hpp"
+
+#include <mutex>
+
+stringpool::stringpool() {
+    this->strings.emplace_back();
+    this->ids[this->strings.back()] = empty_string;
+}
+
+/*
+    Obter o identificador de "value", guardando-o no conjunto caso ainda não exista.
+    As chaves da tabela apontam para os textos guardados na deque, que nunca mudam de endereço.
+*/
+string_id stringpool::intern(std::string_view value) {
+    {
+        std::shared_lock<std::shared_mutex> lock(this->mutex);
+        auto found = this->ids.find(value);
+        if (found != this->ids.end()) {
+            return found->second;
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(this->mutex);
+    auto found = this->ids.find(value);
+    if (found != this->ids.end()) {
+        return found->second;
+    }
+
+    string_id id = this->strings.size();
+    this->strings.emplace_back(value);
+    this->ids[this->strings.back()] = id;
+    return id;
+}
+
+/*
+    Procurar "value" sem o acrescentar ao conjunto (ex. texto introduzido pelo utilizador).
+*/
+bool stringpool::find(std::string_view value, string_id& id) const {
+    std::shared_lock<std::shared_mutex> lock(this->mutex);
+    auto found = this->ids.find(value);
+    if (found == this->ids.end()) {
+        return false;
+    }
+    id = found->second;
+    return true;
+}
+
+const std::string& stringpool::lookup(string_id id) const {
+    std::shared_lock<std::shared_mutex> lock(this->mutex);
+    return this->strings[id];
+}
+
+size_t stringpool::size() const {
+    std::shared_lock<std::shared_mutex> lock(this->mutex);
+    return this->strings.size();
+}
+
+stringpool& stringpool::global() {
+    static stringpool pool;
+    return pool;
+}
@@ -0,0 +1,187 @@
+#include "themecatalog.hpp"
+
+theme_info* themecatalog::find(string_id name) {
+    auto position = this->positions.find(name);
+    if (position == this->positions.end()) {
+        return nullptr;
+    }
+    return &this->themes[position->second];
+}
+
+/*
+    Obter o tema "name", criando-o sem palavras no fim do catálogo caso ainda não exista.
+*/
+theme_info& themecatalog::add(string_id name) {
+    theme_info* found = find(name);
+    if (found != nullptr) {
+        return *found;
+    }
+
+    this->positions[name] = this->themes.size();
+    this->themes.push_back({name, {}, {}});
+    return this->themes.back();
+}
+
+/*
+    Remover o tema "name", mantendo a ordem dos restantes. As posições dos temas seguintes
+    são atualizadas, pelo que referências anteriores para temas do catálogo deixam de ser válidas.
+*/
+bool themecatalog::remove(string_id name) {
+    auto position = this->positions.find(name);
+    if (position == this->positions.end()) {
+        return false;
+    }
+
+    size_t removed = position->second;
+    this->positions.erase(position);
+    this->themes.erase(this->themes.begin() + removed);
+
+    for (size_t i = removed; i < this->themes.size(); i++) {
+        this->positions[this->themes[i].name] = i;
+    }
+    return true;
+}
+
+theme_info& themecatalog::operator[](size_t index) {
+    return this->themes[index];
+}
+
+size_t themecatalog::size() const {
+    return this->themes.size();
+}
+
+void themecatalog::clear() {
+    this->themes.clear();
+    this->positions.clear();
+    this->metadata.clear();
+}
+
+/*
+    Obter as propriedades da palavra "word", calculando-as apenas na primeira vez.
+*/
+const word_metadata& themecatalog::describe(string_id word) {
+    return describe(word, getString(word));
+}
+
+const word_metadata& themecatalog::describe(string_id word, std::string_view text) {
+    if (word >= this->metadata.size()) {
+        this->metadata.resize(word + 1, {letter_set(), 0, -1, empty_string});
+    }
+
+    if (this->metadata[word].length < 0) {
+        this->metadata[word] = describeWord(text, word);
+    }
+    return this->metadata[word];
+}
+
+// Propriedades de uma palavra do catálogo, ou nullptr se a palavra nunca lá esteve.
+const word_metadata* themecatalog::getMetadata(string_id word) const {
+    if ((word >= this->metadata.size()) || (this->metadata[word].length < 0)) {
+        return nullptr;
+    }
+    return &this->metadata[word];
+}
+
+std::vector<theme_info>::iterator themecatalog::begin() {
+    return this->themes.begin();
+}
+
+std::vector<theme_info>::iterator themecatalog::end() {
+    return this->themes.end();
+}
+
+/*
+    Ler os temas no formato de "themes.txt". Um tema que já exista no catálogo fica com as
+    palavras lidas. Em caso de erro, o erro é indicado pelo leitor.
+*/
+bool themecatalog::parse(textparser& data) {
+    int themeCount = 0;
+    if (!data.nextInt(themeCount, "numero de temas")) {
+        return false;
+    }
+
+    for (int i = 0; i < themeCount; i++) {
+        int wordCount = 0;
+        std::string_view name;
+        int occurences = 0;
+
+        if (!data.nextInt(wordCount, "numero de palavras")) {
+            return false;
+        }
+
+        // Um tema sem linhas não tem nome e é ignorado.
+        if (wordCount <= 0) {
+            continue;
+        }
+
+        // O nome do tema é contado como a primeira palavra.
+        if (!data.nextToken(name, "tema", max_name_length) || !data.nextInt(occurences, "ocorrencias")) {
+            return false;
+        }
+
+        theme_info& theme = add(internString(name));
+        theme.words.clear();
+        theme.words.reserve(wordCount - 1);
+
+        for (int j = 1; j < wordCount; j++) {
+            std::string_view word;
+            word_info loaded;
+            if (!data.nextToken(word, "palavra", max_word_length) || !data.nextInt(loaded.occurences, "ocorrencias")) {
+                return false;
+            }
+            loaded.word = internString(word);
+            describe(loaded.word, word);
+            theme.words.push_back(loaded);
+        }
+        updateSampler(theme);
+    }
+
+    return true;
+}
+
+void themecatalog::write(std::stringstream& data) const {
+    data << this->themes.size() << "\n";
+    for (const theme_info& theme : this->themes) {
+        data << theme.words.size() + 1 << "\n";
+        data << getString(theme.name) << " " << 0 << "\n";
+        for (const word_info& word : theme.words) {
+            data << getString(word.word) << " " << word.occurences << "\n";
+        }
+    }
+}
+
+/*
+    Reconstruir o sorteio do tema a partir das ocorrências atuais das suas palavras.
+*/
+void themecatalog::updateSampler(theme_info& theme) {
+    std::vector<long long> weights(theme.words.size());
+    for (size_t i = 0; i < theme.words.size(); i++) {
+        weights[i] = getWordWeight(theme.words[i].occurences);
+    }
+    theme.sampler.assign(std::move(weights));
+}
+
+/*
+    Escolher a palavra do tema correspondente a "threshold" (entre 0 e o total dos pesos) e
+    contar a sua ocorrência, devolvendo a sua posição. O tema não pode estar vazio.
+    Se nenhuma palavra for escolhida, as ocorrências voltam a 1 e é devolvida a última palavra.
+*/
+size_t themecatalog::drawWord(theme_info& theme, long long threshold) {
+    size_t index = theme.sampler.find(threshold);
+    if (index < theme.words.size()) {
+        word_info& word = theme.words[index];
+        int weight = getWordWeight(word.occurences);
+        word.occurences++;
+        theme.sampler.update(index, getWordWeight(word.occurences) - weight);
+        return index;
+    }
+
+    for (word_info& word : theme.words) {
+        if (word.occurences == 0) {
+            continue;
+        }
+        word.occurences = 1;
+    }
+    updateSampler(theme);
+    return theme.words.size() - 1;
+}
@@ -0,0 +1,36 @@
+#include "wordmetadata.hpp"
+
+#include <string>
+
+/*
+    Calcular as propriedades de "word", cujo identificador é "id" se já estiver no conjunto de
+    textos. A forma normalizada só é construída (e guardada no conjunto de textos) se a
+    palavra tiver maiúsculas (ASCII); caso contrário é a própria palavra.
+*/
+word_metadata describeWord(std::string_view word, string_id id) {
+    word_metadata metadata;
+    bool lowercase = true;
+
+    for (char letter : word) {
+        metadata.letters[(unsigned char)letter] = true;
+        lowercase = lowercase && ((letter < 'A') || (letter > 'Z'));
+    }
+
+    metadata.unique = metadata.letters.count();
+    metadata.length = word.size();
+    metadata.normalized = id;
+
+    if (!lowercase) {
+        std::string normalized(word);
+        for (char& letter : normalized) {
+            if ((letter >= 'A') && (letter <= 'Z')) {
+                letter += 'a' - 'A';
+            }
+        }
+        metadata.normalized = internString(normalized);
+    } else if (id == empty_string) {
+        metadata.normalized = internString(word);
+    }
+    return metadata;
+}
+
@@ -0,0 +1,68 @@
+#include "wordsampler.hpp"
+
+/*
+    Construir a árvore a partir dos pesos de cada palavra, em tempo linear: cada posição
+    acumula o seu peso na posição responsável pelo intervalo seguinte que a contém.
+*/
+void wordsampler::assign(std::vector<long long> weights) {
+    this->tree = std::move(weights);
+    this->sum = 0;
+    for (long long weight : this->tree) {
+        this->sum += weight;
+    }
+
+    size_t count = this->tree.size();
+    for (size_t i = 0; i < count; i++) {
+        size_t parent = i | (i + 1);
+        if (parent < count) {
+            this->tree[parent] += this->tree[i];
+        }
+    }
+
+    this->top_step = 1;
+    while (this->top_step * 2 <= count) {
+        this->top_step *= 2;
+    }
+}
+
+void wordsampler::update(size_t index, long long delta) {
+    this->sum += delta;
+    for (size_t i = index; i < this->tree.size(); i = i | (i + 1)) {
+        this->tree[i] += delta;
+    }
+}
+
+/*
+    Descer pela árvore, acumulando os intervalos cuja soma ainda não ultrapassa "threshold".
+    A posição seguinte é a palavra escolhida; "size()" indica que nenhuma palavra foi escolhida
+    ("threshold" igual ou superior ao total).
+*/
+size_t wordsampler::find(long long threshold) const {
+    if (this->tree.empty()) {
+        return 0;
+    }
+
+    size_t position = 0;
+    for (size_t step = this->top_step; step > 0; step /= 2) {
+        size_t next = position + step;
+        if ((next <= this->tree.size()) && (this->tree[next - 1] <= threshold)) {
+            position = next;
+            threshold -= this->tree[next - 1];
+        }
+    }
+    return position;
+}
+
+long long wordsampler::total() const {
+    return this->sum;
+}
+
+size_t wordsampler::size() const {
+    return this->tree.size();
+}
+
+void wordsampler::clear() {
+    this->tree.clear();
+    this->sum = 0;
+    this->top_step = 0;
+}
@@ -0,0 +1,84 @@
+#include "workpool.hpp"
+
+#include <algorithm>
+#include <thread>
+
+/*
+    Com 0 threads é utilizada uma thread por núcleo do processador.
+*/
+workpool::workpool(size_t workers) {
+    if (workers == 0) {
+        workers = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    for (size_t i = 0; i < workers; i++) {
+        this->queues.push_back(std::make_unique<task_queue>());
+    }
+}
+
+size_t workpool::size() const {
+    return this->queues.size();
+}
+
+/*
+    Obter a próxima tarefa da thread "worker": a última da sua fila ou, se estiver vazia, a
+    primeira da fila de outra thread, começando pela seguinte. Como não são criadas tarefas
+    durante a execução, quando todas as filas estão vazias a thread termina.
+*/
+bool workpool::next(size_t worker, size_t& task) {
+    {
+        task_queue& own = *this->queues[worker];
+        std::lock_guard<std::mutex> guard(own.lock);
+        if (!own.tasks.empty()) {
+            task = own.tasks.back();
+            own.tasks.pop_back();
+            return true;
+        }
+    }
+
+    for (size_t offset = 1; offset < this->queues.size(); offset++) {
+        task_queue& victim = *this->queues[(worker + offset) % this->queues.size()];
+        std::lock_guard<std::mutex> guard(victim.lock);
+        if (!victim.tasks.empty()) {
+            task = victim.tasks.front();
+            victim.tasks.pop_front();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*
+    Executar "function" para cada tarefa de 0 a "tasks - 1", esperando que terminem todas.
+    A thread que chama é utilizada como a thread 0.
+*/
+void workpool::run(size_t tasks, const std::function<void(size_t worker, size_t task)>& function) {
+    size_t workers = this->queues.size();
+    for (size_t worker = 0; worker < workers; worker++) {
+        task_queue& queue = *this->queues[worker];
+        std::lock_guard<std::mutex> guard(queue.lock);
+        queue.tasks.clear();
+        // As primeiras tarefas de cada bloco ficam no fim da fila, para serem as primeiras executadas.
+        for (size_t task = tasks * (worker + 1) / workers; task > tasks * worker / workers; task--) {
+            queue.tasks.push_back(task - 1);
+        }
+    }
+
+    auto work = [&](size_t worker) {
+        size_t task;
+        while (next(worker, task)) {
+            function(worker, task);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t worker = 1; worker < workers; worker++) {
+        threads.emplace_back(work, worker);
+    }
+    work(0);
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
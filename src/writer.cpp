@@ -0,0 +1,88 @@
+#include "writer.hpp"
+
+writer::writer() {
+    this->busy = false;
+    this->stopping = false;
+    this->worker = std::thread(&writer::run, this);
+}
+
+/*
+    Ao terminar, todos os pedidos pendentes são gravados antes de a thread parar.
+*/
+writer::~writer() {
+    {
+        std::unique_lock<std::mutex> guard(this->lock);
+        this->stopping = true;
+    }
+    this->work_available.notify_all();
+    this->worker.join();
+}
+
+void writer::replace(std::string filename, std::string data) {
+    submit(JOB_REPLACE, std::move(filename), std::move(data));
+}
+
+void writer::append(std::string filename, std::string data) {
+    submit(JOB_APPEND, std::move(filename), std::move(data));
+}
+
+void writer::submit(int kind, std::string filename, std::string data) {
+    std::unique_lock<std::mutex> guard(this->lock);
+
+    if (!this->jobs.empty() && (this->jobs.back().kind == kind) && (this->jobs.back().filename == filename)) {
+        if (kind == JOB_REPLACE) {
+            this->jobs.back().data = std::move(data);
+        } else {
+            this->jobs.back().data += data;
+        }
+        return;
+    }
+
+    this->work_done.wait(guard, [this]() {
+        return this->jobs.size() < capacity;
+    });
+
+    this->jobs.push_back({kind, std::move(filename), std::move(data)});
+    this->work_available.notify_one();
+}
+
+/*
+    Esperar até que todos os pedidos entregues até agora estejam gravados.
+*/
+void writer::flush() {
+    std::unique_lock<std::mutex> guard(this->lock);
+    this->work_done.wait(guard, [this]() {
+        return this->jobs.empty() && !this->busy;
+    });
+}
+
+void writer::run() {
+    std::unique_lock<std::mutex> guard(this->lock);
+
+    while (true) {
+        this->work_available.wait(guard, [this]() {
+            return !this->jobs.empty() || this->stopping;
+        });
+
+        if (this->jobs.empty()) {
+            break;
+        }
+
+        job current = std::move(this->jobs.front());
+        this->jobs.pop_front();
+        this->busy = true;
+        guard.unlock();
+
+        bool written = (current.kind == JOB_REPLACE)
+            ? replaceFileData(current.filename, current.data)
+            : appendFileData(current.filename, current.data);
+
+        if (!written) {
+            std::cerr << "Erro: Nao foi possivel escrever o ficheiro \'" << current.filename << "\'\n";
+        }
+
+        guard.lock();
+        this->busy = false;
+        this->work_done.notify_all();
+    }
+}
@@ -0,0 +1,118 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "atlas.hpp"
+
+/*
+    Gerador do cabeçalho "embedded.hpp", utilizado pelo Makefile para incluir as imagens e os
+    temas por omissão no executável.
+
+    Utilização: embed <images.txt> <themes.txt> <embedded.hpp>
+*/
+
+bool readFile(std::string filename, std::string& data) {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        std::cout << "Erro: Nao foi possivel abrir o ficheiro \'" << filename << "\'\n";
+        return false;
+    }
+
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    data = buffer.str();
+    return true;
+}
+
+/*
+    Confirmar a geometria das imagens em tempo de compilação, para que o atlas embutido
+    nunca precise de ser validado ao arrancar.
+*/
+bool validateImages(std::string filename, std::string& data) {
+    if ((data.size() + 1) % atlas::image_size == 0) {
+        data += '\n';
+    }
+
+    if ((data.size() == 0) || (data.size() % atlas::image_size != 0)) {
+        std::cout << "Erro: O ficheiro \'" << filename << "\' nao contem imagens de "
+            << atlas::image_height << "x" << atlas::image_width << " bytes\n";
+        return false;
+    }
+
+    for (size_t i = atlas::image_width - 1; i < data.size(); i += atlas::image_width) {
+        if (data[i] != '\n') {
+            std::cout << "Erro: O ficheiro \'" << filename << "\' tem uma linha com tamanho invalido (linha "
+                << (i / atlas::image_width) + 1 << ")\n";
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Escrever o conteúdo como uma sequência de literais, uma linha do ficheiro por literal.
+void writeLiteral(std::ostream& output, const std::string& data) {
+    output << "    \"";
+    for (char c : data) {
+        switch (c) {
+        case '\n':
+            output << "\\n\"\n    \"";
+            break;
+        case '\\':
+            output << "\\\\";
+            break;
+        case '\"':
+            output << "\\\"";
+            break;
+        case '?':
+            // Evitar trigraphs.
+            output << "\\?";
+            break;
+        default:
+            output << c;
+        }
+    }
+    output << "\"";
+}
+
+int main(int argc, char** argv) {
+    if (argc != 4) {
+        std::cout << "Utilizacao: " << argv[0] << " <images.txt> <themes.txt> <embedded.hpp>\n";
+        return -1;
+    }
+
+    std::string images;
+    std::string themes;
+
+    if (!readFile(argv[1], images) || !validateImages(argv[1], images) || !readFile(argv[2], themes)) {
+        return -1;
+    }
+
+    std::stringstream output;
+
+    output << "// Gerado pelo Makefile a partir de \'" << argv[1] << "\' e \'" << argv[2] << "\'. Nao editar.\n"
+        << "#ifndef EMBEDDED_HPP\n"
+        << "#define EMBEDDED_HPP\n\n"
+        << "#include <string_view>\n\n"
+        << "inline constexpr int embedded_image_width = " << atlas::image_width << ";\n"
+        << "inline constexpr int embedded_image_height = " << atlas::image_height << ";\n"
+        << "inline constexpr int embedded_image_count = " << images.size() / atlas::image_size << ";\n\n"
+        << "inline constexpr char embedded_images[] =\n";
+    writeLiteral(output, images);
+    output << ";\n\n"
+        << "inline constexpr char embedded_themes[] =\n";
+    writeLiteral(output, themes);
+    output << ";\n\n"
+        << "static_assert(sizeof(embedded_images) - 1 == embedded_image_count * embedded_image_width * embedded_image_height);\n\n"
+        << "#endif\n";
+
+    std::ofstream file(argv[3], std::ios::binary);
+    if (!file.is_open()) {
+        std::cout << "Erro: Nao foi possivel abrir o ficheiro \'" << argv[3] << "\'\n";
+        return -1;
+    }
+    file << output.str();
+
+    return 0;
+}